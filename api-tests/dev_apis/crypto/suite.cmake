@@ -31,9 +31,8 @@ foreach(test ${PSA_TEST_LIST})
 	unset(AS_SOURCE)
 endforeach()
 
-add_definitions(${CC_OPTIONS})
-add_definitions(${AS_OPTIONS})
-add_library(${PSA_TARGET_TEST_COMBINE_LIB} STATIC ${SUITE_CC_SOURCE} ${SUITE_AS_SOURCE})
+add_library(${PSA_TARGET_TEST_COMBINE_LIB} ${PSA_TEST_COMBINE_LIB_TYPE} ${SUITE_CC_SOURCE} ${SUITE_AS_SOURCE})
+target_compile_options(${PSA_TARGET_TEST_COMBINE_LIB} PRIVATE ${CC_OPTIONS} ${AS_OPTIONS})
 
 # Test related Include directories
 foreach(test ${PSA_TEST_LIST})
@@ -0,0 +1,92 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_crypto_perf_common.h"
+
+/* Message buffers shared by the tests of the suite */
+uint8_t        crypto_perf_input[CRYPTO_PERF_MAX_MSG_SIZE + CRYPTO_PERF_OUTPUT_PAD];
+uint8_t        crypto_perf_output[CRYPTO_PERF_MAX_MSG_SIZE + CRYPTO_PERF_OUTPUT_PAD];
+
+/* Message sizes in bytes, sizes above CRYPTO_PERF_MAX_MSG_SIZE are not measured */
+const uint32_t crypto_perf_sizes[CRYPTO_PERF_NUM_SIZES] = {
+    16, 64, 256, 1024, 4096, 16384, 65536,
+};
+
+/* Direct crypto entry points used by the measured operations */
+const val_crypto_ops_t *crypto_perf_ops;
+
+/**
+    @brief    - Looks up the direct crypto entry points of the platform, so that the
+                measurements do not include the va_list decoding of crypto_function
+    @param    - val_api : VAL API table of the calling test
+    @return   - VAL_STATUS_SUCCESS, VAL_STATUS_UNSUPPORTED if the platform has no table
+**/
+int32_t crypto_perf_get_ops(val_api_t *val_api)
+{
+    crypto_perf_ops = val_api->crypto_get_ops();
+    if (crypto_perf_ops == NULL)
+    {
+        val_api->print(PRINT_ERROR, "\tNo direct crypto entry points on the platform\n", 0);
+        return VAL_STATUS_UNSUPPORTED;
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Measures an operation and prints its [Perf] line. An operation which fails,
+                e.g. because the backend does not support the message size for the mode,
+                is reported with "failed" instead of the measurement.
+    @param    - val_api : VAL API table of the calling test
+                op      : Name of the measured operation
+                alg     : Algorithm of the operation
+                size    : Message size in bytes, 0 if not applicable
+                fn      : Operation to measure
+                ctx     : Argument passed to the operation
+    @return   - VAL_STATUS_UNSUPPORTED if the platform has no cycle counter
+**/
+int32_t crypto_perf_run(val_api_t *val_api, char *op, uint32_t alg, uint32_t size,
+                        val_perf_fn_t fn, void *ctx)
+{
+    val_perf_result_t   result;
+    int32_t             status;
+
+    /* Setting up the watchdog timer for each measurement */
+    status = val_api->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    status = val_api->perf_measure(fn, ctx, &result);
+    if (status == VAL_STATUS_UNSUPPORTED)
+    {
+        return status;
+    }
+
+    if (VAL_ERROR(status))
+    {
+        val_api->print(PRINT_ALWAYS, "[Perf] op=", 0);
+        val_api->print(PRINT_ALWAYS, op, 0);
+        val_api->print(PRINT_ALWAYS, " alg=0x%x", alg);
+        val_api->print(PRINT_ALWAYS, " size=%d failed\n", size);
+        return VAL_STATUS_SUCCESS;
+    }
+
+    val_api->perf_report(op, alg, size, &result);
+    return VAL_STATUS_SUCCESS;
+}
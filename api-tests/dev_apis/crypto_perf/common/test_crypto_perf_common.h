@@ -0,0 +1,54 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+#ifndef _TEST_CRYPTO_PERF_COMMON_H_
+#define _TEST_CRYPTO_PERF_COMMON_H_
+
+#include "val_interfaces.h"
+#include "val_crypto.h"
+
+/* Largest message size to measure, may be lowered for targets with little RAM */
+#ifndef CRYPTO_PERF_MAX_MSG_SIZE
+#define CRYPTO_PERF_MAX_MSG_SIZE        65536
+#endif
+
+/* Room for an IV, padding or tag in addition to the message. Decrypted messages are
+ * written back to the input buffer, so both buffers have it.
+ */
+#define CRYPTO_PERF_OUTPUT_PAD          64
+
+#define CRYPTO_PERF_NUM_SIZES           7
+
+extern uint8_t        crypto_perf_input[CRYPTO_PERF_MAX_MSG_SIZE + CRYPTO_PERF_OUTPUT_PAD];
+extern uint8_t        crypto_perf_output[CRYPTO_PERF_MAX_MSG_SIZE + CRYPTO_PERF_OUTPUT_PAD];
+extern const uint32_t crypto_perf_sizes[CRYPTO_PERF_NUM_SIZES];
+extern const val_crypto_ops_t *crypto_perf_ops;
+
+/* Skips the test if the platform has no cycle counter, fails it on other errors */
+#define CRYPTO_PERF_ASSERT_RUN(status, checkpoint)                                  \
+    do {                                                                            \
+        if ((status) == VAL_STATUS_UNSUPPORTED)                                     \
+        {                                                                           \
+            val->print(PRINT_TEST, "No cycle counter on the platform\n", 0);         \
+            return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);                             \
+        }                                                                           \
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, checkpoint);                  \
+    } while (0)
+
+int32_t crypto_perf_get_ops(val_api_t *val_api);
+int32_t crypto_perf_run(val_api_t *val_api, char *op, uint32_t alg, uint32_t size,
+                        val_perf_fn_t fn, void *ctx);
+#endif /* _TEST_CRYPTO_PERF_COMMON_H_ */
@@ -0,0 +1,125 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_f001.h"
+#include "test_c006/test_data.h"
+
+client_test_t test_f001_crypto_list[] = {
+    NULL,
+    crypto_perf_hash_test,
+    NULL,
+};
+
+typedef struct {
+    psa_algorithm_t         alg;
+    size_t                  size;
+} hash_perf_ctx_t;
+
+static int g_test_count = 1;
+
+static int32_t hash_compute_op(void *arg)
+{
+    hash_perf_ctx_t         *ctx = arg;
+    size_t                  hash_length;
+
+    return crypto_perf_ops->hash_compute(ctx->alg, crypto_perf_input, ctx->size, crypto_perf_output,
+                                         sizeof(crypto_perf_output), &hash_length);
+}
+
+static int32_t hash_multipart_op(void *arg)
+{
+    hash_perf_ctx_t         *ctx = arg;
+    psa_hash_operation_t    operation = PSA_HASH_OPERATION_INIT;
+    size_t                  hash_length;
+    int32_t                 status;
+
+    status = crypto_perf_ops->hash_setup(&operation, ctx->alg);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    status = crypto_perf_ops->hash_update(&operation, crypto_perf_input, ctx->size);
+    if (status != PSA_SUCCESS)
+    {
+        crypto_perf_ops->hash_abort(&operation);
+        return status;
+    }
+
+    return crypto_perf_ops->hash_finish(&operation, crypto_perf_output, sizeof(crypto_perf_output),
+                                        &hash_length);
+}
+
+int32_t crypto_perf_hash_test(security_t caller)
+{
+    int                     num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t                 i, j, status;
+    hash_perf_ctx_t         ctx;
+
+    /* Expected digests of the functional test are not used */
+    (void)sha384_hash;
+    (void)sha512_hash;
+
+    if (num_checks == 0)
+    {
+        val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    /* The measured operations call the crypto implementation directly */
+    status = crypto_perf_get_ops(val);
+    TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        if (check1[i].expected_status != PSA_SUCCESS)
+        {
+            continue;
+        }
+
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        ctx.alg = check1[i].alg;
+        for (j = 0; j < CRYPTO_PERF_NUM_SIZES; j++)
+        {
+            if (crypto_perf_sizes[j] > CRYPTO_PERF_MAX_MSG_SIZE)
+            {
+                break;
+            }
+            ctx.size = crypto_perf_sizes[j];
+
+            /* One-shot hash of the message */
+            status = crypto_perf_run(val, "hash_compute", ctx.alg, ctx.size, hash_compute_op,
+                                     &ctx);
+            CRYPTO_PERF_ASSERT_RUN(status, TEST_CHECKPOINT_NUM(2));
+
+            /* Same message through setup, update and finish */
+            status = crypto_perf_run(val, "hash_multipart", ctx.alg, ctx.size, hash_multipart_op,
+                                     &ctx);
+            CRYPTO_PERF_ASSERT_RUN(status, TEST_CHECKPOINT_NUM(3));
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
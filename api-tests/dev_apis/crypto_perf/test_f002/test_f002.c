@@ -0,0 +1,140 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_f002.h"
+#include "test_c046/test_data.h"
+
+client_test_t test_f002_crypto_list[] = {
+    NULL,
+    crypto_perf_mac_test,
+    NULL,
+};
+
+typedef struct {
+    psa_key_handle_t        key_handle;
+    psa_algorithm_t         alg;
+    size_t                  size;
+} mac_perf_ctx_t;
+
+static int g_test_count = 1;
+
+static int32_t mac_compute_op(void *arg)
+{
+    mac_perf_ctx_t          *ctx = arg;
+    size_t                  mac_length;
+
+    return crypto_perf_ops->mac_compute(ctx->key_handle, ctx->alg, crypto_perf_input, ctx->size,
+                                        crypto_perf_output, sizeof(crypto_perf_output),
+                                        &mac_length);
+}
+
+static int32_t mac_multipart_op(void *arg)
+{
+    mac_perf_ctx_t          *ctx = arg;
+    psa_mac_operation_t     operation = PSA_MAC_OPERATION_INIT;
+    size_t                  mac_length;
+    int32_t                 status;
+
+    status = crypto_perf_ops->mac_sign_setup(&operation, ctx->key_handle, ctx->alg);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    status = crypto_perf_ops->mac_update(&operation, crypto_perf_input, ctx->size);
+    if (status != PSA_SUCCESS)
+    {
+        crypto_perf_ops->mac_abort(&operation);
+        return status;
+    }
+
+    return crypto_perf_ops->mac_sign_finish(&operation, crypto_perf_output,
+                                            sizeof(crypto_perf_output), &mac_length);
+}
+
+int32_t crypto_perf_mac_test(security_t caller)
+{
+    int                     num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t                 i, j, status;
+    mac_perf_ctx_t          ctx;
+    psa_key_attributes_t    attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+    if (num_checks == 0)
+    {
+        val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    /* The measured operations call the crypto implementation directly */
+    status = crypto_perf_get_ops(val);
+    TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        if (check1[i].expected_status != PSA_SUCCESS)
+        {
+            continue;
+        }
+
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        /* Setup the attributes for the key */
+        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, check1[i].key_type);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM, &attributes, check1[i].key_alg);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage);
+
+        /* Import the key data into the key slot */
+        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].key_data,
+                 check1[i].key_length, &ctx.key_handle);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        ctx.alg = check1[i].key_alg;
+        for (j = 0; j < CRYPTO_PERF_NUM_SIZES; j++)
+        {
+            if (crypto_perf_sizes[j] > CRYPTO_PERF_MAX_MSG_SIZE)
+            {
+                break;
+            }
+            ctx.size = crypto_perf_sizes[j];
+
+            /* One-shot MAC of the message */
+            status = crypto_perf_run(val, "mac_compute", ctx.alg, ctx.size, mac_compute_op, &ctx);
+            CRYPTO_PERF_ASSERT_RUN(status, TEST_CHECKPOINT_NUM(3));
+
+            /* Same message through sign setup, update and sign finish */
+            status = crypto_perf_run(val, "mac_multipart", ctx.alg, ctx.size, mac_multipart_op,
+                                     &ctx);
+            CRYPTO_PERF_ASSERT_RUN(status, TEST_CHECKPOINT_NUM(4));
+        }
+
+        /* Destroy the key */
+        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, ctx.key_handle);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+
+        /* Reset the key attributes */
+        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
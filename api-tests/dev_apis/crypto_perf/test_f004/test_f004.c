@@ -0,0 +1,138 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_f004.h"
+#include "test_c024/test_data.h"
+
+client_test_t test_f004_crypto_list[] = {
+    NULL,
+    crypto_perf_aead_test,
+    NULL,
+};
+
+typedef struct {
+    psa_key_handle_t        key_handle;
+    test_data               *data;
+    size_t                  size;
+    size_t                  output_length;
+} aead_perf_ctx_t;
+
+static int g_test_count = 1;
+
+static int32_t aead_encrypt_op(void *arg)
+{
+    aead_perf_ctx_t         *ctx = arg;
+
+    return crypto_perf_ops->aead_encrypt(ctx->key_handle, ctx->data->key_alg, ctx->data->nonce,
+                                         ctx->data->nonce_length, ctx->data->additional_data,
+                                         ctx->data->additional_data_length, crypto_perf_input,
+                                         ctx->size, crypto_perf_output, sizeof(crypto_perf_output),
+                                         &ctx->output_length);
+}
+
+static int32_t aead_decrypt_op(void *arg)
+{
+    aead_perf_ctx_t         *ctx = arg;
+    size_t                  length;
+
+    /* Decrypts the output of the last encryption back into the input buffer */
+    return crypto_perf_ops->aead_decrypt(ctx->key_handle, ctx->data->key_alg, ctx->data->nonce,
+                                         ctx->data->nonce_length, ctx->data->additional_data,
+                                         ctx->data->additional_data_length, crypto_perf_output,
+                                         ctx->output_length, crypto_perf_input,
+                                         sizeof(crypto_perf_input), &length);
+}
+
+int32_t crypto_perf_aead_test(security_t caller)
+{
+    int                     num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t                 i, j, status;
+    aead_perf_ctx_t         ctx;
+    psa_key_attributes_t    attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+    if (num_checks == 0)
+    {
+        val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    /* The measured operations call the crypto implementation directly */
+    status = crypto_perf_get_ops(val);
+    TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        if (check1[i].expected_status != PSA_SUCCESS)
+        {
+            continue;
+        }
+
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        /* Setup the attributes for the key, usable in both directions */
+        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, check1[i].key_type);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM, &attributes, check1[i].key_alg);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes,
+                             PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT);
+
+        /* Import the key data into the key slot */
+        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].key_data,
+                 check1[i].key_length, &ctx.key_handle);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        ctx.data = &check1[i];
+        for (j = 0; j < CRYPTO_PERF_NUM_SIZES; j++)
+        {
+            if (crypto_perf_sizes[j] > CRYPTO_PERF_MAX_MSG_SIZE)
+            {
+                break;
+            }
+            ctx.size = crypto_perf_sizes[j];
+            ctx.output_length = 0;
+
+            status = crypto_perf_run(val, "aead_encrypt", check1[i].key_alg, ctx.size,
+                                     aead_encrypt_op, &ctx);
+            CRYPTO_PERF_ASSERT_RUN(status, TEST_CHECKPOINT_NUM(3));
+
+            /* Nothing to decrypt if the encryption failed, e.g. message too long for CCM */
+            if (ctx.output_length == 0)
+            {
+                continue;
+            }
+
+            status = crypto_perf_run(val, "aead_decrypt", check1[i].key_alg, ctx.size,
+                                     aead_decrypt_op, &ctx);
+            CRYPTO_PERF_ASSERT_RUN(status, TEST_CHECKPOINT_NUM(4));
+        }
+
+        /* Destroy the key */
+        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, ctx.key_handle);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+
+        /* Reset the key attributes */
+        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
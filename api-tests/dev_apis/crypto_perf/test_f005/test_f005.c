@@ -0,0 +1,166 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_f005.h"
+#include "test_c041/test_data.h"
+
+client_test_t test_f005_crypto_list[] = {
+    NULL,
+    crypto_perf_sign_test,
+    NULL,
+};
+
+typedef struct {
+    psa_key_handle_t        key_handle;
+    test_data               *data;
+    size_t                  signature_length;
+} sign_perf_ctx_t;
+
+static int g_test_count = 1;
+
+/* Returns the key material of a check, the same way the functional test selects it */
+static const uint8_t *get_key_data(test_data *data)
+{
+    if (PSA_KEY_TYPE_IS_RSA(data->key_type))
+    {
+        if (data->key_type == PSA_KEY_TYPE_RSA_KEY_PAIR)
+        {
+            if (data->expected_bit_length == BYTES_TO_BITS(384))
+                return rsa_384_keypair;
+            else if (data->expected_bit_length == BYTES_TO_BITS(256))
+                return rsa_256_keypair;
+            else if (data->expected_bit_length == BYTES_TO_BITS(128))
+                return rsa_128_keypair;
+        }
+        else
+        {
+            if (data->expected_bit_length == BYTES_TO_BITS(384))
+                return rsa_384_keydata;
+            else if (data->expected_bit_length == BYTES_TO_BITS(256))
+                return rsa_256_keydata;
+            else if (data->expected_bit_length == BYTES_TO_BITS(128))
+                return rsa_128_keydata;
+        }
+        return NULL;
+    }
+    else if (PSA_KEY_TYPE_IS_ECC(data->key_type))
+    {
+        if (PSA_KEY_TYPE_IS_ECC_KEY_PAIR(data->key_type))
+            return ec_keypair;
+        else
+            return ec_keydata;
+    }
+
+    return data->key_data;
+}
+
+static int32_t asymmetric_sign_op(void *arg)
+{
+    sign_perf_ctx_t         *ctx = arg;
+
+    return crypto_perf_ops->asymmetric_sign(ctx->key_handle, ctx->data->key_alg, ctx->data->input,
+                                            ctx->data->input_length, crypto_perf_output,
+                                            sizeof(crypto_perf_output), &ctx->signature_length);
+}
+
+static int32_t asymmetric_verify_op(void *arg)
+{
+    sign_perf_ctx_t         *ctx = arg;
+
+    return crypto_perf_ops->asymmetric_verify(ctx->key_handle, ctx->data->key_alg, ctx->data->input,
+                                              ctx->data->input_length, crypto_perf_output,
+                                              ctx->signature_length);
+}
+
+int32_t crypto_perf_sign_test(security_t caller)
+{
+    int                     num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t                 i, status;
+    const uint8_t           *key_data;
+    sign_perf_ctx_t         ctx;
+    psa_key_attributes_t    attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+    /* Verification checks of the functional test are not used */
+    (void)check2;
+
+    if (num_checks == 0)
+    {
+        val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    /* The measured operations call the crypto implementation directly */
+    status = crypto_perf_get_ops(val);
+    TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        if (check1[i].expected_status != PSA_SUCCESS)
+        {
+            continue;
+        }
+
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        key_data = get_key_data(&check1[i]);
+        if (key_data == NULL)
+        {
+            return VAL_STATUS_INVALID;
+        }
+
+        /* Setup the attributes for the key, usable in both directions */
+        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, check1[i].key_type);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM, &attributes, check1[i].key_alg);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes,
+                             PSA_KEY_USAGE_SIGN | PSA_KEY_USAGE_VERIFY);
+
+        /* Import the key data into the key slot */
+        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, key_data,
+                 check1[i].key_length, &ctx.key_handle);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        /* The input is a hash or short message, so no size is reported */
+        ctx.data = &check1[i];
+        ctx.signature_length = 0;
+        status = crypto_perf_run(val, "asymmetric_sign", check1[i].key_alg, 0,
+                                 asymmetric_sign_op, &ctx);
+        CRYPTO_PERF_ASSERT_RUN(status, TEST_CHECKPOINT_NUM(4));
+
+        if (ctx.signature_length != 0)
+        {
+            status = crypto_perf_run(val, "asymmetric_verify", check1[i].key_alg, 0,
+                                     asymmetric_verify_op, &ctx);
+            CRYPTO_PERF_ASSERT_RUN(status, TEST_CHECKPOINT_NUM(5));
+        }
+
+        /* Destroy the key */
+        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, ctx.key_handle);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
+
+        /* Reset the key attributes */
+        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
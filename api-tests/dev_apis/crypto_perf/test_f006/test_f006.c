@@ -0,0 +1,168 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_f006.h"
+#include "test_c039/test_data.h"
+
+client_test_t test_f006_crypto_list[] = {
+    NULL,
+    crypto_perf_asym_encrypt_test,
+    NULL,
+};
+
+typedef struct {
+    psa_key_handle_t        key_handle;
+    test_data               *data;
+    const uint8_t           *salt;
+    size_t                  output_length;
+} asym_perf_ctx_t;
+
+static int g_test_count = 1;
+
+/* Returns the RSA key pair matching the key size of a check, so that the same key can
+ * be used to decrypt the messages encrypted with its public part.
+ */
+static const uint8_t *get_key_pair(test_data *data, size_t *length)
+{
+    if (data->expected_bit_length == BYTES_TO_BITS(384))
+    {
+        *length = sizeof(rsa_384_keypair);
+        return rsa_384_keypair;
+    }
+    else if (data->expected_bit_length == BYTES_TO_BITS(256))
+    {
+        *length = sizeof(rsa_256_keypair);
+        return rsa_256_keypair;
+    }
+    else if (data->expected_bit_length == BYTES_TO_BITS(128))
+    {
+        *length = sizeof(rsa_128_keypair);
+        return rsa_128_keypair;
+    }
+
+    return NULL;
+}
+
+static int32_t asymmetric_encrypt_op(void *arg)
+{
+    asym_perf_ctx_t         *ctx = arg;
+
+    return crypto_perf_ops->asymmetric_encrypt(ctx->key_handle, ctx->data->key_alg,
+                                               ctx->data->input, ctx->data->input_length, ctx->salt,
+                                               ctx->data->salt_length, crypto_perf_output,
+                                               sizeof(crypto_perf_output), &ctx->output_length);
+}
+
+static int32_t asymmetric_decrypt_op(void *arg)
+{
+    asym_perf_ctx_t         *ctx = arg;
+    size_t                  length;
+
+    /* Decrypts the output of the last encryption */
+    return crypto_perf_ops->asymmetric_decrypt(ctx->key_handle, ctx->data->key_alg,
+                                               crypto_perf_output, ctx->output_length, ctx->salt,
+                                               ctx->data->salt_length, crypto_perf_input,
+                                               sizeof(crypto_perf_input), &length);
+}
+
+int32_t crypto_perf_asym_encrypt_test(security_t caller)
+{
+    int                     num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t                 i, status;
+    const uint8_t           *key_data;
+    size_t                  key_length;
+    asym_perf_ctx_t         ctx;
+    psa_key_attributes_t    attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+    /* Public keys and decryption checks of the functional test are not used */
+    (void)rsa_384_keydata;
+    (void)rsa_256_keydata;
+    (void)rsa_128_keydata;
+    (void)ec_keydata;
+    (void)ec_keypair;
+    (void)check2;
+
+    if (num_checks == 0)
+    {
+        val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    /* The measured operations call the crypto implementation directly */
+    status = crypto_perf_get_ops(val);
+    TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        /* Only RSA keys support asymmetric encryption */
+        if ((check1[i].expected_status != PSA_SUCCESS) ||
+            !PSA_KEY_TYPE_IS_RSA(check1[i].key_type))
+        {
+            continue;
+        }
+
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        key_data = get_key_pair(&check1[i], &key_length);
+        if (key_data == NULL)
+        {
+            return VAL_STATUS_INVALID;
+        }
+
+        /* Setup the attributes for the key, usable in both directions */
+        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, PSA_KEY_TYPE_RSA_KEY_PAIR);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM, &attributes, check1[i].key_alg);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes,
+                             PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT);
+
+        /* Import the key data into the key slot */
+        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, key_data,
+                 key_length, &ctx.key_handle);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        /* The input is a short message, so no size is reported */
+        ctx.data = &check1[i];
+        ctx.salt = check1[i].salt_length ? check1[i].salt : NULL;
+        ctx.output_length = 0;
+        status = crypto_perf_run(val, "asymmetric_encrypt", check1[i].key_alg, 0,
+                                 asymmetric_encrypt_op, &ctx);
+        CRYPTO_PERF_ASSERT_RUN(status, TEST_CHECKPOINT_NUM(3));
+
+        if (ctx.output_length != 0)
+        {
+            status = crypto_perf_run(val, "asymmetric_decrypt", check1[i].key_alg, 0,
+                                     asymmetric_decrypt_op, &ctx);
+            CRYPTO_PERF_ASSERT_RUN(status, TEST_CHECKPOINT_NUM(4));
+        }
+
+        /* Destroy the key */
+        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, ctx.key_handle);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+
+        /* Reset the key attributes */
+        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,137 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_f007.h"
+#include "test_c020/test_data.h"
+
+/* Largest output to measure, well below the 255 blocks HKDF can produce with SHA-256 */
+#define KEY_DERIVATION_MAX_OUTPUT   4096
+
+client_test_t test_f007_crypto_list[] = {
+    NULL,
+    crypto_perf_key_derivation_test,
+    NULL,
+};
+
+typedef struct {
+    psa_key_handle_t        key_handle;
+    test_data               *data;
+    size_t                  size;
+} kdf_perf_ctx_t;
+
+static int g_test_count = 1;
+
+static int32_t key_derivation_op(void *arg)
+{
+    kdf_perf_ctx_t                  *ctx = arg;
+    psa_key_derivation_operation_t  operation = PSA_KEY_DERIVATION_OPERATION_INIT;
+    int32_t                         status;
+
+    status = crypto_perf_ops->key_derivation_setup(&operation, ctx->data->key_alg);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    status = crypto_perf_ops->key_derivation_set_capacity(&operation, ctx->size);
+    if (status == PSA_SUCCESS)
+    {
+        status = crypto_perf_ops->key_derivation_input_key(&operation, ctx->data->step,
+                                                           ctx->key_handle);
+    }
+
+    if (status == PSA_SUCCESS)
+    {
+        status = crypto_perf_ops->key_derivation_output_bytes(&operation, crypto_perf_output,
+                                                              ctx->size);
+    }
+
+    crypto_perf_ops->key_derivation_abort(&operation);
+    return status;
+}
+
+int32_t crypto_perf_key_derivation_test(security_t caller)
+{
+    int                     num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t                 i, j, status;
+    kdf_perf_ctx_t          ctx;
+    psa_key_attributes_t    attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+    if (num_checks == 0)
+    {
+        val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    /* The measured operations call the crypto implementation directly */
+    status = crypto_perf_get_ops(val);
+    TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        /* Only the checks deriving from a key are measured */
+        if ((check1[i].expected_status != PSA_SUCCESS) ||
+            (check1[i].step != PSA_KEY_DERIVATION_INPUT_SECRET))
+        {
+            continue;
+        }
+
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        /* Setup the attributes for the key */
+        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, check1[i].key_type);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM, &attributes, check1[i].key_alg);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage);
+
+        /* Import the key data into the key slot */
+        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].key_data,
+                 check1[i].key_length, &ctx.key_handle);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        ctx.data = &check1[i];
+        for (j = 0; j < CRYPTO_PERF_NUM_SIZES; j++)
+        {
+            if ((crypto_perf_sizes[j] > CRYPTO_PERF_MAX_MSG_SIZE) ||
+                (crypto_perf_sizes[j] > KEY_DERIVATION_MAX_OUTPUT))
+            {
+                break;
+            }
+            ctx.size = crypto_perf_sizes[j];
+
+            /* Complete derivation of size bytes, from setup to abort */
+            status = crypto_perf_run(val, "key_derivation", check1[i].key_alg, ctx.size,
+                                     key_derivation_op, &ctx);
+            CRYPTO_PERF_ASSERT_RUN(status, TEST_CHECKPOINT_NUM(3));
+        }
+
+        /* Destroy the key */
+        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, ctx.key_handle);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+        /* Reset the key attributes */
+        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
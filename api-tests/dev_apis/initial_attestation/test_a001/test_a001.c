@@ -34,7 +34,7 @@ int32_t psa_initial_attestation_get_token_test(security_t caller)
     int         num_checks = sizeof(check1)/sizeof(check1[0]);
     uint32_t    i;
     int32_t     status;
-    size_t      token_buffer_size, token_size;
+    size_t      token_buffer_size, token_size, offset, chunk_size;
     uint8_t     challenge[PSA_INITIAL_ATTEST_CHALLENGE_SIZE_64+1];
     uint8_t     token_buffer[TOKEN_SIZE];
 
@@ -72,6 +72,25 @@ int32_t psa_initial_attestation_get_token_test(security_t caller)
         status = val->attestation_function(VAL_INITIAL_ATTEST_VERIFY_TOKEN, challenge,
                     check1[i].challenge_size, token_buffer, token_size);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        /* Validate the token again, passing it in chunks */
+        status = val->attestation_function(VAL_INITIAL_ATTEST_VERIFY_TOKEN_START, challenge,
+                    check1[i].challenge_size);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        for (offset = 0; offset < token_size; offset += chunk_size)
+        {
+            chunk_size = token_size - offset;
+            if (chunk_size > TOKEN_CHUNK_SIZE)
+                chunk_size = TOKEN_CHUNK_SIZE;
+
+            status = val->attestation_function(VAL_INITIAL_ATTEST_VERIFY_TOKEN_UPDATE,
+                        token_buffer + offset, chunk_size);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+        }
+
+        status = val->attestation_function(VAL_INITIAL_ATTEST_VERIFY_TOKEN_FINISH);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
     }
 
     return VAL_STATUS_SUCCESS;
@@ -23,6 +23,7 @@
 #define psa CONCAT(psa, test_entry)
 
 #define TOKEN_SIZE          512
+#define TOKEN_CHUNK_SIZE    16
 
 extern val_api_t *val;
 extern psa_api_t *psa;
@@ -26,6 +26,10 @@
 #endif
 #define val CONCAT(val, test_entry)
 #define psa CONCAT(psa, test_entry)
+#define test_s002_sst_list CONCAT(test_s002_sst_list, test_entry)
+#define psa_sst_update_write_once_flag_after_create \
+        CONCAT(psa_sst_update_write_once_flag_after_create, test_entry)
+#define psa_sst_create_with_write_once_flag CONCAT(psa_sst_create_with_write_once_flag, test_entry)
 
 extern val_api_t *val;
 extern psa_api_t *psa;
@@ -26,6 +26,8 @@
 #endif
 #define val CONCAT(val, test_entry)
 #define psa CONCAT(psa, test_entry)
+#define test_s004_sst_list CONCAT(test_s004_sst_list, test_entry)
+#define psa_sst_get_data_check CONCAT(psa_sst_get_data_check, test_entry)
 
 extern val_api_t *val;
 extern psa_api_t *psa;
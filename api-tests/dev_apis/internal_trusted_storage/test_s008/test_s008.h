@@ -26,6 +26,9 @@
 #endif
 #define val CONCAT(val, test_entry)
 #define psa CONCAT(psa, test_entry)
+#define test_s008_sst_list CONCAT(test_s008_sst_list, test_entry)
+#define psa_sst_valid_offset_success CONCAT(psa_sst_valid_offset_success, test_entry)
+#define psa_sst_invalid_offset_failure CONCAT(psa_sst_invalid_offset_failure, test_entry)
 
 extern val_api_t *val;
 extern psa_api_t *psa;
@@ -36,8 +36,7 @@ foreach(test ${PSA_TEST_LIST})
 	endforeach()
 	if((${SUITE} STREQUAL "PROTECTED_STORAGE") AND
 	   (${ITS_TEST_STR} STREQUAL "test_p"))
-		add_definitions(${CC_OPTIONS})
-		add_definitions(${AS_OPTIONS})
+		list(APPEND PS_CC_OPTIONS ${CC_OPTIONS} ${AS_OPTIONS})
 	endif()
 	unset(CC_SOURCE)
 	unset(AS_SOURCE)
@@ -45,7 +44,8 @@ foreach(test ${PSA_TEST_LIST})
 	unset(CC_OPTIONS)
 endforeach()
 
-add_library(${PSA_TARGET_TEST_COMBINE_LIB} STATIC ${SUITE_CC_SOURCE} ${SUITE_AS_SOURCE})
+add_library(${PSA_TARGET_TEST_COMBINE_LIB} ${PSA_TEST_COMBINE_LIB_TYPE} ${SUITE_CC_SOURCE} ${SUITE_AS_SOURCE})
+target_compile_options(${PSA_TARGET_TEST_COMBINE_LIB} PRIVATE ${PS_CC_OPTIONS})
 
 # Test related Include directories
 foreach(test ${PSA_TEST_LIST})
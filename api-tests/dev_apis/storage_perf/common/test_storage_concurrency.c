@@ -0,0 +1,151 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+#include "test_storage_perf_common.h"
+
+#define STORAGE_CONCURRENCY_NAME_LEN    32
+
+#ifdef CONCURRENCY_STRESS_THREADS
+/* Object data, each thread reads into its own buffer */
+static uint8_t storage_concurrency_write_buff[STORAGE_PERF_UID_OBJ_SIZE];
+static uint8_t storage_concurrency_read_buff[VAL_STRESS_MAX_THREADS][STORAGE_PERF_UID_OBJ_SIZE];
+
+/* Operation of every client thread, a get of the whole object of the thread */
+static int32_t storage_concurrency_get_op(void *arg, uint32_t thread)
+{
+    storage_perf_ctx_t      *ctx = arg;
+    size_t                  length = 0;
+    int32_t                 status;
+
+    status = ctx->function(ctx->api->get, STORAGE_CONCURRENCY_UID_BASE + thread, 0,
+                           STORAGE_PERF_UID_OBJ_SIZE, storage_concurrency_read_buff[thread],
+                           &length);
+    if ((status == PSA_SUCCESS) && (length != STORAGE_PERF_UID_OBJ_SIZE))
+    {
+        return VAL_STATUS_DATA_MISMATCH;
+    }
+    return status;
+}
+
+static void storage_concurrency_remove(storage_perf_ctx_t *ctx, uint32_t threads)
+{
+    uint32_t                i;
+
+    for (i = 0; i < threads; i++)
+    {
+        ctx->function(ctx->api->remove, STORAGE_CONCURRENCY_UID_BASE + i);
+    }
+}
+#endif
+
+/**
+    @brief    - Runs get from 1, 2, 4 and up to CONCURRENCY_STRESS_THREADS client threads
+                at once, each thread on its own object, and prints a [Stress] line for
+                every number of threads. A client thread which is starved of the
+                storage fails the test, errors of the operations are only reported.
+    @param    - val_api : VAL API table of the calling test
+                ctx     : Context from storage_perf_init
+    @return   - VAL_STATUS_UNSUPPORTED if the stress is off or the platform has no
+                threads or no cycle counter, VAL_STATUS_ERROR if a thread was starved
+**/
+int32_t storage_concurrency_test(val_api_t *val_api, storage_perf_ctx_t *ctx)
+{
+#ifdef CONCURRENCY_STRESS_THREADS
+    val_stress_result_t     result;
+    char                    name[STORAGE_CONCURRENCY_NAME_LEN];
+    const char              *prefix, *op;
+    uint32_t                max_threads, threads, i;
+    int32_t                 status = VAL_STATUS_SUCCESS;
+
+    max_threads = (CONCURRENCY_STRESS_THREADS < VAL_STRESS_MAX_THREADS) ?
+                   CONCURRENCY_STRESS_THREADS : VAL_STRESS_MAX_THREADS;
+
+    for (i = 0; i < STORAGE_PERF_UID_OBJ_SIZE; i++)
+    {
+        storage_concurrency_write_buff[i] = (uint8_t)i;
+    }
+
+    for (i = 0; i < max_threads; i++)
+    {
+        status = ctx->function(ctx->api->set, STORAGE_CONCURRENCY_UID_BASE + i,
+                               STORAGE_PERF_UID_OBJ_SIZE, storage_concurrency_write_buff,
+                               PSA_STORAGE_FLAG_NONE);
+        if (status != PSA_SUCCESS)
+        {
+            val_api->print(PRINT_ERROR, "Could not write the object of thread %d\n", i);
+            storage_concurrency_remove(ctx, i);
+            return VAL_STATUS_WRITE_FAILED;
+        }
+    }
+
+    prefix = ctx->api->name;
+    op = "_get";
+    i = 0;
+    while (*prefix && (i < (STORAGE_CONCURRENCY_NAME_LEN - 5)))
+    {
+        name[i++] = *prefix++;
+    }
+    while (*op)
+    {
+        name[i++] = *op++;
+    }
+    name[i] = '\0';
+
+    threads = 1;
+    while (threads <= max_threads)
+    {
+        status = val_api->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        if (VAL_ERROR(status))
+        {
+            break;
+        }
+
+        status = val_api->stress_run(storage_concurrency_get_op, ctx, threads, &result);
+        if (status == VAL_STATUS_UNSUPPORTED)
+        {
+            val_api->print(PRINT_TEST, "No threads or cycle counter on the platform\n", 0);
+            break;
+        }
+        if (VAL_ERROR(status))
+        {
+            break;
+        }
+
+        val_api->stress_report(name, &result);
+        if (result.starved > 0)
+        {
+            val_api->print(PRINT_ERROR, "%d client thread(s) starved\n", result.starved);
+            status = VAL_STATUS_ERROR;
+            break;
+        }
+
+        /* 1, 2, 4 and so on, the last run is on all the threads */
+        if (threads == max_threads)
+        {
+            break;
+        }
+        threads = ((threads * 2) < max_threads) ? (threads * 2) : max_threads;
+    }
+
+    storage_concurrency_remove(ctx, max_threads);
+    return status;
+#else
+    (void)ctx;
+    val_api->print(PRINT_TEST, "Concurrency stress is off, build with "
+                   "-DCONCURRENCY_STRESS_THREADS=<threads>\n", 0);
+    return VAL_STATUS_UNSUPPORTED;
+#endif
+}
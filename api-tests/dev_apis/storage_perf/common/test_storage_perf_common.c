@@ -0,0 +1,512 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+#include "test_storage_perf_common.h"
+
+#define STORAGE_PERF_NAME_LEN           32
+
+/* Object data, the read buffer takes the data of get */
+static uint8_t storage_perf_write_buff[STORAGE_PERF_MAX_OBJ_SIZE];
+static uint8_t storage_perf_read_buff[STORAGE_PERF_MAX_OBJ_SIZE];
+
+/* Object sizes in bytes, sizes above STORAGE_PERF_MAX_OBJ_SIZE are not measured */
+const uint32_t storage_perf_sizes[STORAGE_PERF_NUM_SIZES] = {
+    1, 16, 64, 256, 1024, 4096, 16384,
+};
+
+/* Number of objects in storage for the measurements across several UIDs */
+const uint32_t storage_perf_uid_counts[STORAGE_PERF_NUM_UID_COUNTS] = {
+    1, 4, STORAGE_PERF_MAX_UIDS,
+};
+
+const storage_perf_api_t storage_perf_its_api = {
+    "its", VAL_ITS_SET, VAL_ITS_GET, VAL_ITS_GET_INFO, VAL_ITS_REMOVE, 0, 0,
+};
+
+const storage_perf_api_t storage_perf_ps_api = {
+    "ps", VAL_PS_SET, VAL_PS_GET, VAL_PS_GET_INFO, VAL_PS_REMOVE, VAL_PS_CREATE,
+    VAL_PS_SET_EXTENDED,
+};
+
+static psa_storage_uid_t storage_perf_uid(storage_perf_ctx_t *ctx)
+{
+    return STORAGE_PERF_UID_BASE + ctx->index;
+}
+
+static void storage_perf_next(storage_perf_ctx_t *ctx)
+{
+    ctx->index = (ctx->index + 1) % ctx->num_uids;
+}
+
+static int32_t storage_perf_write(storage_perf_ctx_t *ctx)
+{
+    return ctx->function(ctx->api->set, storage_perf_uid(ctx), ctx->size,
+                         storage_perf_write_buff, PSA_STORAGE_FLAG_NONE);
+}
+
+/* Measured operations, each one goes on to the next object */
+static int32_t storage_perf_set_op(void *arg)
+{
+    storage_perf_ctx_t      *ctx = arg;
+    int32_t                 status;
+
+    status = storage_perf_write(ctx);
+    storage_perf_next(ctx);
+    return status;
+}
+
+static int32_t storage_perf_get_op(void *arg)
+{
+    storage_perf_ctx_t      *ctx = arg;
+    size_t                  length = 0;
+    int32_t                 status;
+
+    status = ctx->function(ctx->api->get, storage_perf_uid(ctx), ctx->offset, ctx->length,
+                           storage_perf_read_buff, &length);
+    storage_perf_next(ctx);
+    if ((status == PSA_SUCCESS) && (length != ctx->length))
+    {
+        return VAL_STATUS_DATA_MISMATCH;
+    }
+    return status;
+}
+
+static int32_t storage_perf_get_info_op(void *arg)
+{
+    storage_perf_ctx_t          *ctx = arg;
+    struct psa_storage_info_t   info;
+    int32_t                     status;
+
+    status = ctx->function(ctx->api->get_info, storage_perf_uid(ctx), &info);
+    storage_perf_next(ctx);
+    if ((status == PSA_SUCCESS) && (info.size != ctx->size))
+    {
+        return VAL_STATUS_DATA_MISMATCH;
+    }
+    return status;
+}
+
+static int32_t storage_perf_remove_op(void *arg)
+{
+    storage_perf_ctx_t      *ctx = arg;
+    int32_t                 status;
+
+    status = ctx->function(ctx->api->remove, storage_perf_uid(ctx));
+    storage_perf_next(ctx);
+    return status;
+}
+
+static int32_t storage_perf_create_op(void *arg)
+{
+    storage_perf_ctx_t      *ctx = arg;
+    int32_t                 status;
+
+    status = ctx->function(ctx->api->create, storage_perf_uid(ctx), ctx->size,
+                           PSA_STORAGE_FLAG_NONE);
+    storage_perf_next(ctx);
+    return status;
+}
+
+static int32_t storage_perf_set_extended_op(void *arg)
+{
+    storage_perf_ctx_t      *ctx = arg;
+    int32_t                 status;
+
+    status = ctx->function(ctx->api->set_extended, storage_perf_uid(ctx), ctx->offset,
+                           ctx->length, storage_perf_write_buff);
+    storage_perf_next(ctx);
+    return status;
+}
+
+/* Untimed setup operations, they prepare the object of the next measured operation */
+static int32_t storage_perf_restore_op(void *arg)
+{
+    return storage_perf_write(arg);
+}
+
+static int32_t storage_perf_delete_op(void *arg)
+{
+    storage_perf_ctx_t      *ctx = arg;
+
+    /* The object does not exist before the first create */
+    ctx->function(ctx->api->remove, storage_perf_uid(ctx));
+    return PSA_SUCCESS;
+}
+
+/**
+    @brief    - Writes the objects of all the UIDs of the measurement
+    @param    - ctx     : Object size and number of UIDs
+    @return   - PSA status of the first write which failed
+**/
+static int32_t storage_perf_populate(storage_perf_ctx_t *ctx)
+{
+    int32_t                 status = PSA_SUCCESS;
+
+    for (ctx->index = 0; ctx->index < ctx->num_uids; ctx->index++)
+    {
+        status = storage_perf_write(ctx);
+        if (status != PSA_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    ctx->index = 0;
+    return status;
+}
+
+/**
+    @brief    - Searches the largest object size that the storage takes, between a size
+                it took and a size it rejected. The object of the first UID is left
+                with the size found.
+    @param    - ctx     : Storage API, the size is updated
+                taken   : Size taken by the storage
+                rejected: Size rejected by the storage
+    @return   - Largest size taken
+**/
+static uint32_t storage_perf_largest_size(storage_perf_ctx_t *ctx, uint32_t taken,
+                                          uint32_t rejected)
+{
+    ctx->index = 0;
+    while ((rejected - taken) > 1)
+    {
+        ctx->size = taken + ((rejected - taken) / 2);
+        if (storage_perf_write(ctx) == PSA_SUCCESS)
+        {
+            taken = ctx->size;
+        }
+        else
+        {
+            rejected = ctx->size;
+        }
+    }
+
+    ctx->size = taken;
+    storage_perf_write(ctx);
+    return taken;
+}
+
+static void storage_perf_op_name(char *name, char *prefix, char *op)
+{
+    uint32_t                i = 0;
+
+    while (*prefix && (i < (STORAGE_PERF_NAME_LEN - 2)))
+    {
+        name[i++] = *prefix++;
+    }
+    name[i++] = '_';
+    while (*op && (i < (STORAGE_PERF_NAME_LEN - 1)))
+    {
+        name[i++] = *op++;
+    }
+    name[i] = '\0';
+}
+
+/**
+    @brief    - Measures the latency of an operation on the objects of the context and
+                prints its [Perf] line, with the number of UIDs as alg. An operation
+                which fails is reported with "failed" instead of the measurement.
+    @param    - val_api : VAL API table of the calling test
+                op      : Name of the operation, prefixed with the name of the API
+                ctx     : Objects of the measurement
+                bytes   : Number of bytes transferred by one operation, 0 if none
+                setup   : Untimed operation run before each timed one, or NULL
+                fn      : Operation to measure
+    @return   - VAL_STATUS_UNSUPPORTED if the platform has no cycle counter,
+                an error status if the operation failed
+**/
+static int32_t storage_perf_run(val_api_t *val_api, char *op, storage_perf_ctx_t *ctx,
+                                uint32_t bytes, val_perf_fn_t setup, val_perf_fn_t fn)
+{
+    val_perf_latency_t      result;
+    char                    name[STORAGE_PERF_NAME_LEN];
+    int32_t                 status;
+
+    storage_perf_op_name(name, ctx->api->name, op);
+
+    /* Writes to flash may be slow, use the longest timeout of the target */
+    status = val_api->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    ctx->index = 0;
+    status = val_api->perf_measure_latency(setup, fn, ctx, STORAGE_PERF_ITERATIONS, &result);
+    if (status == VAL_STATUS_UNSUPPORTED)
+    {
+        return status;
+    }
+
+    if (VAL_ERROR(status))
+    {
+        val_api->print(PRINT_ALWAYS, "[Perf] op=", 0);
+        val_api->print(PRINT_ALWAYS, name, 0);
+        val_api->print(PRINT_ALWAYS, " alg=0x%x", ctx->num_uids);
+        val_api->print(PRINT_ALWAYS, " size=%d failed\n", ctx->size);
+        return status;
+    }
+
+    val_api->perf_report_latency(name, ctx->num_uids, ctx->size, bytes, &result);
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Measures set, get of the whole object and get of its second half on
+                one object of the given size
+    @param    - val_api : VAL API table of the calling test
+                ctx     : Objects of the measurement, already written
+    @return   - val_status_t
+**/
+static int32_t storage_perf_measure_size(val_api_t *val_api, storage_perf_ctx_t *ctx)
+{
+    int32_t                 status;
+
+    ctx->offset = 0;
+    ctx->length = ctx->size;
+    status = storage_perf_run(val_api, "set", ctx, ctx->size, NULL, storage_perf_set_op);
+    if (status != VAL_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    status = storage_perf_run(val_api, "get", ctx, ctx->length, NULL, storage_perf_get_op);
+    if (status != VAL_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    ctx->offset = ctx->size / 2;
+    ctx->length = ctx->size - ctx->offset;
+    return storage_perf_run(val_api, "get_offset", ctx, ctx->length, NULL,
+                            storage_perf_get_op);
+}
+
+/**
+    @brief    - Initializes the context of a measurement for the given storage API
+    @param    - ctx      : Context to initialize
+                function : VAL function of the storage API
+                api      : Function codes of the storage API
+    @return   - void
+**/
+void storage_perf_init(storage_perf_ctx_t *ctx, uint32_t (*function)(int type, ...),
+                       const storage_perf_api_t *api)
+{
+    uint32_t                i;
+
+    for (i = 0; i < STORAGE_PERF_MAX_OBJ_SIZE; i++)
+    {
+        storage_perf_write_buff[i] = (uint8_t)i;
+    }
+
+    ctx->function = function;
+    ctx->api = api;
+    ctx->size = 0;
+    ctx->offset = 0;
+    ctx->length = 0;
+    ctx->num_uids = 1;
+    ctx->index = 0;
+}
+
+/**
+    @brief    - Measures set and get on one UID with sizes from 1 byte up to the
+                largest size that the storage takes, or STORAGE_PERF_MAX_OBJ_SIZE
+    @param    - val_api : VAL API table of the calling test
+                ctx     : Context from storage_perf_init
+    @return   - val_status_t
+**/
+int32_t storage_perf_size_test(val_api_t *val_api, storage_perf_ctx_t *ctx)
+{
+    uint32_t                i, taken = 0;
+    int32_t                 status;
+
+    ctx->num_uids = 1;
+    for (i = 0; i < STORAGE_PERF_NUM_SIZES; i++)
+    {
+        if (storage_perf_sizes[i] > STORAGE_PERF_MAX_OBJ_SIZE)
+        {
+            break;
+        }
+
+        ctx->size = storage_perf_sizes[i];
+        if (storage_perf_populate(ctx) != PSA_SUCCESS)
+        {
+            if (i == 0)
+            {
+                val_api->print(PRINT_ERROR, "\tSet of a %d byte object failed\n", ctx->size);
+                return VAL_STATUS_ERROR;
+            }
+
+            /* Measure the largest size too, unless it is the size just measured */
+            if (storage_perf_largest_size(ctx, taken, ctx->size) == taken)
+            {
+                break;
+            }
+            val_api->print(PRINT_TEST, "Largest object size: %d\n", ctx->size);
+            return storage_perf_measure_size(val_api, ctx);
+        }
+
+        status = storage_perf_measure_size(val_api, ctx);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        taken = ctx->size;
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Measures set, get, get_info and remove with 1 to STORAGE_PERF_MAX_UIDS
+                objects of STORAGE_PERF_UID_OBJ_SIZE bytes in storage. The operations
+                go through the objects in turn.
+    @param    - val_api : VAL API table of the calling test
+                ctx     : Context from storage_perf_init
+    @return   - val_status_t
+**/
+int32_t storage_perf_uid_test(val_api_t *val_api, storage_perf_ctx_t *ctx)
+{
+    uint32_t                i;
+    int32_t                 status;
+
+    ctx->size = STORAGE_PERF_UID_OBJ_SIZE;
+    if (ctx->size > STORAGE_PERF_MAX_OBJ_SIZE)
+    {
+        ctx->size = STORAGE_PERF_MAX_OBJ_SIZE;
+    }
+    ctx->offset = 0;
+    ctx->length = ctx->size;
+
+    for (i = 0; i < STORAGE_PERF_NUM_UID_COUNTS; i++)
+    {
+        ctx->num_uids = storage_perf_uid_counts[i];
+        status = storage_perf_populate(ctx);
+        if (status != PSA_SUCCESS)
+        {
+            if (i == 0)
+            {
+                val_api->print(PRINT_ERROR, "\tSet of a %d byte object failed\n", ctx->size);
+                return VAL_STATUS_ERROR;
+            }
+
+            /* The storage may hold only a few objects */
+            val_api->print(PRINT_TEST, "Storage takes fewer than %d objects\n", ctx->num_uids);
+            break;
+        }
+
+        status = storage_perf_run(val_api, "set", ctx, ctx->size, NULL, storage_perf_set_op);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        status = storage_perf_run(val_api, "get", ctx, ctx->size, NULL, storage_perf_get_op);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        status = storage_perf_run(val_api, "get_info", ctx, 0, NULL, storage_perf_get_info_op);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        /* Each object is written again before it is removed */
+        status = storage_perf_run(val_api, "remove", ctx, 0, storage_perf_restore_op,
+                                  storage_perf_remove_op);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Measures create and set_extended on one UID with sizes from 1 byte up to
+                the first size that create fails for, or STORAGE_PERF_MAX_OBJ_SIZE.
+                set_extended writes the whole object, then its second half.
+    @param    - val_api : VAL API table of the calling test
+                ctx     : Context from storage_perf_init, of an API with create and
+                          set_extended
+    @return   - val_status_t
+**/
+int32_t storage_perf_extended_test(val_api_t *val_api, storage_perf_ctx_t *ctx)
+{
+    uint32_t                i;
+    int32_t                 status;
+
+    ctx->num_uids = 1;
+    for (i = 0; i < STORAGE_PERF_NUM_SIZES; i++)
+    {
+        if (storage_perf_sizes[i] > STORAGE_PERF_MAX_OBJ_SIZE)
+        {
+            break;
+        }
+
+        /* Each object is removed again before it is created */
+        ctx->size = storage_perf_sizes[i];
+        status = storage_perf_run(val_api, "create", ctx, 0, storage_perf_delete_op,
+                                  storage_perf_create_op);
+        if (status == VAL_STATUS_UNSUPPORTED)
+        {
+            return status;
+        }
+
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            /* Above the largest size that the storage takes */
+            return (i == 0) ? status : VAL_STATUS_SUCCESS;
+        }
+
+        ctx->offset = 0;
+        ctx->length = ctx->size;
+        status = storage_perf_run(val_api, "set_extended", ctx, ctx->length, NULL,
+                                  storage_perf_set_extended_op);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        ctx->offset = ctx->size / 2;
+        ctx->length = ctx->size - ctx->offset;
+        status = storage_perf_run(val_api, "set_extended_offset", ctx, ctx->length, NULL,
+                                  storage_perf_set_extended_op);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Removes the objects that the measurements may have left in storage
+    @param    - ctx     : Context of the measurements
+    @return   - void
+**/
+void storage_perf_cleanup(storage_perf_ctx_t *ctx)
+{
+    for (ctx->index = 0; ctx->index < STORAGE_PERF_MAX_UIDS; ctx->index++)
+    {
+        ctx->function(ctx->api->remove, storage_perf_uid(ctx));
+    }
+    ctx->index = 0;
+}
@@ -0,0 +1,130 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+#ifndef _TEST_STORAGE_PERF_COMMON_H_
+#define _TEST_STORAGE_PERF_COMMON_H_
+
+#include "val_interfaces.h"
+#include "val_internal_trusted_storage.h"
+#include "val_protected_storage.h"
+
+/* Largest object size to measure, may be lowered for targets with little RAM. Sizes the
+ * storage rejects are not measured, so this may be above the limit of the implementation.
+ */
+#ifndef STORAGE_PERF_MAX_OBJ_SIZE
+#define STORAGE_PERF_MAX_OBJ_SIZE       4096
+#endif
+
+#define STORAGE_PERF_NUM_SIZES          7
+#define STORAGE_PERF_NUM_UID_COUNTS     3
+#define STORAGE_PERF_MAX_UIDS           16
+
+/* Object size of the measurements across several UIDs */
+#define STORAGE_PERF_UID_OBJ_SIZE       64
+
+/* Timed runs of each operation, the 99th percentile is taken from them */
+#define STORAGE_PERF_ITERATIONS         VAL_PERF_MAX_SAMPLES
+
+/* Above the UIDs of the functional storage suites */
+#define STORAGE_PERF_UID_BASE           0x5000
+
+/* Function codes of one storage API. The optional codes are 0 if not provided. */
+typedef struct {
+    char                    *name;
+    int                     set;
+    int                     get;
+    int                     get_info;
+    int                     remove;
+    int                     create;
+    int                     set_extended;
+} storage_perf_api_t;
+
+/* State shared by the measured operations */
+typedef struct {
+    uint32_t                    (*function)(int type, ...);
+    const storage_perf_api_t    *api;
+    uint32_t                    size;       /* Object size */
+    uint32_t                    offset;     /* Offset of the data read by get or written by
+                                               set_extended */
+    uint32_t                    length;     /* Length of that data */
+    uint32_t                    num_uids;   /* Objects the operations go through in turn */
+    uint32_t                    index;      /* Object of the next operation */
+} storage_perf_ctx_t;
+
+extern const uint32_t storage_perf_sizes[STORAGE_PERF_NUM_SIZES];
+extern const uint32_t storage_perf_uid_counts[STORAGE_PERF_NUM_UID_COUNTS];
+extern const storage_perf_api_t storage_perf_its_api;
+extern const storage_perf_api_t storage_perf_ps_api;
+
+/* Skips the test if the platform has no cycle counter, fails it on other errors */
+#define STORAGE_PERF_ASSERT_RUN(status, checkpoint)                                 \
+    do {                                                                            \
+        if ((status) == VAL_STATUS_UNSUPPORTED)                                     \
+        {                                                                           \
+            val->print(PRINT_TEST, "No cycle counter on the platform\n", 0);         \
+            return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);                             \
+        }                                                                           \
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, checkpoint);                  \
+    } while (0)
+
+/* Stress mode: rounds of filling the storage with objects of mixed sizes, resizing
+ * them and removing them. May be raised for long endurance runs.
+ */
+#ifndef STORAGE_STRESS_ROUNDS
+#define STORAGE_STRESS_ROUNDS           3
+#endif
+
+/* Seed of the random object sizes and UIDs, the same seed gives the same operations */
+#ifndef STORAGE_STRESS_SEED
+#define STORAGE_STRESS_SEED             0x5EED
+#endif
+
+/* Largest object size of the stress, must be taken by the storage */
+#ifndef STORAGE_STRESS_MAX_SIZE
+#define STORAGE_STRESS_MAX_SIZE         512
+#endif
+
+#define STORAGE_STRESS_UIDS             64
+#define STORAGE_STRESS_UID_BASE         0x6000
+#define STORAGE_STRESS_BATCH            32      /* Operations timed together */
+#define STORAGE_STRESS_RESIZE_OPS       128     /* Resizes of each round */
+#define STORAGE_STRESS_MAX_RESETS       3       /* Resets the stress resumes from */
+#define STORAGE_STRESS_MAGIC            0x5354
+
+/* Kept in NVMEM at NV_TEST_CURSOR, so that the stress resumes after a reset */
+typedef struct {
+    uint16_t                    magic;
+    uint16_t                    test_id;
+    uint32_t                    seed;
+    uint32_t                    round;      /* Next round to run */
+    uint32_t                    rng;        /* Random state at the start of that round */
+    uint32_t                    base_stored;/* Bytes in storage when it was full in round 0 */
+    uint32_t                    base_fill;  /* Mean set cycles of the fill of round 0 */
+    uint32_t                    resets;
+} storage_stress_cursor_t;
+
+/* Concurrency stress: the object of client thread n is at STORAGE_CONCURRENCY_UID_BASE + n */
+#define STORAGE_CONCURRENCY_UID_BASE    0x7000
+
+void    storage_perf_init(storage_perf_ctx_t *ctx, uint32_t (*function)(int type, ...),
+                          const storage_perf_api_t *api);
+int32_t storage_perf_size_test(val_api_t *val_api, storage_perf_ctx_t *ctx);
+int32_t storage_perf_uid_test(val_api_t *val_api, storage_perf_ctx_t *ctx);
+int32_t storage_perf_extended_test(val_api_t *val_api, storage_perf_ctx_t *ctx);
+void    storage_perf_cleanup(storage_perf_ctx_t *ctx);
+int32_t storage_stress_test(val_api_t *val_api, storage_perf_ctx_t *ctx);
+int32_t storage_concurrency_test(val_api_t *val_api, storage_perf_ctx_t *ctx);
+#endif /* _TEST_STORAGE_PERF_COMMON_H_ */
@@ -0,0 +1,399 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+#include "test_storage_perf_common.h"
+
+/* Timing of one phase of a stress round, from the batches of its operations */
+typedef struct {
+    uint64_t                total;      /* Cycles of all the operations */
+    uint32_t                ops;
+    uint32_t                p99;        /* Largest 99th percentile of the batches */
+    uint32_t                last;       /* Mean cycles of the last batch */
+} storage_stress_stat_t;
+
+/* State of a stress round */
+typedef struct {
+    storage_perf_ctx_t      *perf;      /* Storage API */
+    uint32_t                rng;
+    uint32_t                sizes[STORAGE_STRESS_UIDS]; /* 0 if the UID is not in storage */
+    uint32_t                live;       /* Objects in storage */
+    uint32_t                stored;     /* Bytes in storage */
+    uint32_t                ops;        /* Set operations of the round */
+    uint32_t                full_after; /* Sets until the first insufficient storage, 0 if none */
+    uint32_t                full_stored;/* Bytes in storage at that point */
+    uint32_t                rejected;   /* Sets rejected with insufficient storage */
+    int32_t                 error;      /* Unexpected PSA status */
+} storage_stress_ctx_t;
+
+static storage_stress_ctx_t g_stress;
+static uint8_t storage_stress_buff[STORAGE_STRESS_MAX_SIZE];
+
+static uint32_t storage_stress_rand(storage_stress_ctx_t *ctx)
+{
+    /* xorshift32, never returns to 0 from a non zero state */
+    ctx->rng ^= ctx->rng << 13;
+    ctx->rng ^= ctx->rng >> 17;
+    ctx->rng ^= ctx->rng << 5;
+    return ctx->rng;
+}
+
+/* Mostly small objects with a few up to STORAGE_STRESS_MAX_SIZE */
+static uint32_t storage_stress_size(storage_stress_ctx_t *ctx)
+{
+    uint32_t                range = STORAGE_STRESS_MAX_SIZE >> (storage_stress_rand(ctx) % 4);
+
+    return 1 + (storage_stress_rand(ctx) % range);
+}
+
+/* Returns the first UID index from a random one on, whose object is or is not in storage */
+static uint32_t storage_stress_pick(storage_stress_ctx_t *ctx, uint32_t in_storage)
+{
+    uint32_t                i, slot = storage_stress_rand(ctx) % STORAGE_STRESS_UIDS;
+
+    for (i = 0; i < STORAGE_STRESS_UIDS; i++)
+    {
+        if ((ctx->sizes[slot] != 0) == (in_storage != 0))
+        {
+            break;
+        }
+        slot = (slot + 1) % STORAGE_STRESS_UIDS;
+    }
+    return slot;
+}
+
+/* Sets the object of a UID to a new random size */
+static int32_t storage_stress_set(storage_stress_ctx_t *ctx, uint32_t slot)
+{
+    uint32_t                size = storage_stress_size(ctx);
+    int32_t                 status;
+
+    status = ctx->perf->function(ctx->perf->api->set, STORAGE_STRESS_UID_BASE + slot, size,
+                                 storage_stress_buff, PSA_STORAGE_FLAG_NONE);
+    ctx->ops++;
+
+    if (status == PSA_SUCCESS)
+    {
+        ctx->live += (ctx->sizes[slot] == 0);
+        ctx->stored += size - ctx->sizes[slot];
+        ctx->sizes[slot] = size;
+        return PSA_SUCCESS;
+    }
+
+    if (status == PSA_ERROR_INSUFFICIENT_STORAGE)
+    {
+        if (ctx->full_after == 0)
+        {
+            ctx->full_after = ctx->ops;
+            ctx->full_stored = ctx->stored;
+        }
+        ctx->rejected++;
+        return PSA_SUCCESS;
+    }
+
+    ctx->error = status;
+    return status;
+}
+
+/* Measured operations */
+static int32_t storage_stress_fill_op(void *arg)
+{
+    storage_stress_ctx_t    *ctx = arg;
+
+    return storage_stress_set(ctx, storage_stress_pick(ctx, 0));
+}
+
+static int32_t storage_stress_resize_op(void *arg)
+{
+    storage_stress_ctx_t    *ctx = arg;
+
+    return storage_stress_set(ctx, storage_stress_pick(ctx, 1));
+}
+
+static int32_t storage_stress_remove_op(void *arg)
+{
+    storage_stress_ctx_t    *ctx = arg;
+    uint32_t                slot = storage_stress_pick(ctx, 1);
+    int32_t                 status;
+
+    status = ctx->perf->function(ctx->perf->api->remove, STORAGE_STRESS_UID_BASE + slot);
+    if (status != PSA_SUCCESS)
+    {
+        ctx->error = status;
+        return status;
+    }
+
+    ctx->live--;
+    ctx->stored -= ctx->sizes[slot];
+    ctx->sizes[slot] = 0;
+    return PSA_SUCCESS;
+}
+
+/**
+    @brief    - Times a batch of stress operations and adds it to the timing of the phase
+    @param    - val_api : VAL API table of the calling test
+                ctx     : Stress round
+                fn      : Operation to run
+                count   : Number of operations
+                stat    : Timing of the phase
+    @return   - val_status_t
+**/
+static int32_t storage_stress_batch(val_api_t *val_api, storage_stress_ctx_t *ctx,
+                                    val_perf_fn_t fn, uint32_t count, storage_stress_stat_t *stat)
+{
+    val_perf_latency_t      result;
+    int32_t                 status;
+
+    /* Writes to flash may be slow, use the longest timeout of the target */
+    status = val_api->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    status = val_api->perf_measure_latency(NULL, fn, ctx, count, &result);
+    if (status == VAL_STATUS_UNSUPPORTED)
+    {
+        return status;
+    }
+
+    if (VAL_ERROR(status))
+    {
+        val_api->print(PRINT_ERROR, "\tStorage operation failed with %d\n", ctx->error);
+        return status;
+    }
+
+    stat->total += (uint64_t)result.mean * result.iterations;
+    stat->ops += result.iterations;
+    stat->last = result.mean;
+    if (result.p99 > stat->p99)
+    {
+        stat->p99 = result.p99;
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+static uint32_t storage_stress_mean(storage_stress_stat_t *stat)
+{
+    return stat->ops ? (uint32_t)(stat->total / stat->ops) : 0;
+}
+
+/**
+    @brief    - Runs one stress round: sets objects of random sizes on free UIDs until
+                the storage is full or all the UIDs are used, resizes random objects,
+                then removes all the objects. Prints one [Stress] line for the round.
+    @param    - val_api : VAL API table of the calling test
+                ctx     : Stress round, with the random state of the round
+                cursor  : Stress state, updated with the reference values in round 0
+    @return   - val_status_t
+**/
+static int32_t storage_stress_round(val_api_t *val_api, storage_stress_ctx_t *ctx,
+                                    storage_stress_cursor_t *cursor)
+{
+    storage_stress_stat_t   fill = {0}, resize = {0}, drain = {0};
+    uint32_t                count, rejected;
+    int32_t                 status;
+
+    ctx->ops = 0;
+    ctx->full_after = 0;
+    ctx->full_stored = 0;
+    ctx->rejected = 0;
+
+    /* Fill until a set is rejected */
+    while ((ctx->full_after == 0) && (ctx->live < STORAGE_STRESS_UIDS))
+    {
+        count = STORAGE_STRESS_UIDS - ctx->live;
+        count = (count < STORAGE_STRESS_BATCH) ? count : STORAGE_STRESS_BATCH;
+        status = storage_stress_batch(val_api, ctx, storage_stress_fill_op, count, &fill);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+    if (ctx->full_after == 0)
+    {
+        ctx->full_stored = ctx->stored;
+    }
+
+    /* Grow and shrink the objects, near full some of the sets are rejected */
+    rejected = ctx->rejected;
+    for (count = 0; (count < STORAGE_STRESS_RESIZE_OPS) && ctx->live;
+         count += STORAGE_STRESS_BATCH)
+    {
+        status = storage_stress_batch(val_api, ctx, storage_stress_resize_op,
+                                      STORAGE_STRESS_BATCH, &resize);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+    rejected = ctx->rejected - rejected;
+
+    while (ctx->live)
+    {
+        count = (ctx->live < STORAGE_STRESS_BATCH) ? ctx->live : STORAGE_STRESS_BATCH;
+        status = storage_stress_batch(val_api, ctx, storage_stress_remove_op, count, &drain);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    if (cursor->round == 0)
+    {
+        /* The free space reclaimed is only known if round 0 filled the storage */
+        cursor->base_stored = ctx->full_after ? ctx->full_stored : 0;
+        cursor->base_fill = storage_stress_mean(&fill);
+    }
+
+    val_api->print(PRINT_ALWAYS, "[Stress] op=", 0);
+    val_api->print(PRINT_ALWAYS, ctx->perf->api->name, 0);
+    val_api->print(PRINT_ALWAYS, " round=%d", cursor->round);
+    val_api->print(PRINT_ALWAYS, " full_after=%d", ctx->full_after);
+    val_api->print(PRINT_ALWAYS, " stored_bytes=%d", ctx->full_stored);
+    if (cursor->base_stored && ctx->full_after)
+    {
+        val_api->print(PRINT_ALWAYS, " reclaim_pct=%d",
+                       (int32_t)(((uint64_t)ctx->full_stored * 100) / cursor->base_stored));
+    }
+    val_api->print(PRINT_ALWAYS, " fill_cycles=%d", storage_stress_mean(&fill));
+    val_api->print(PRINT_ALWAYS, " full_cycles=%d", fill.last);
+    val_api->print(PRINT_ALWAYS, " resize_cycles=%d", storage_stress_mean(&resize));
+    val_api->print(PRINT_ALWAYS, " resize_p99_cycles=%d", resize.p99);
+    val_api->print(PRINT_ALWAYS, " resize_rejected=%d", rejected);
+    val_api->print(PRINT_ALWAYS, " remove_cycles=%d", storage_stress_mean(&drain));
+    if (cursor->base_fill)
+    {
+        val_api->print(PRINT_ALWAYS, " drift_pct=%d",
+                       (int32_t)(((uint64_t)storage_stress_mean(&fill) * 100)
+                                 / cursor->base_fill));
+    }
+    val_api->print(PRINT_ALWAYS, "\n", 0);
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/* Removes the objects that an interrupted or failed round left in storage */
+static void storage_stress_cleanup(storage_stress_ctx_t *ctx)
+{
+    uint32_t                slot;
+
+    for (slot = 0; slot < STORAGE_STRESS_UIDS; slot++)
+    {
+        ctx->perf->function(ctx->perf->api->remove, STORAGE_STRESS_UID_BASE + slot);
+        ctx->sizes[slot] = 0;
+    }
+    ctx->live = 0;
+    ctx->stored = 0;
+}
+
+/**
+    @brief    - Runs STORAGE_STRESS_ROUNDS stress rounds. The state of the stress is kept
+                in NVMEM and the test is marked to continue after a reset, so that the
+                stress resumes from the round that a reset interrupted. Stops after
+                STORAGE_STRESS_MAX_RESETS resets.
+    @param    - val_api : VAL API table of the calling test
+                ctx     : Context from storage_perf_init
+    @return   - val_status_t
+**/
+int32_t storage_stress_test(val_api_t *val_api, storage_perf_ctx_t *ctx)
+{
+    storage_stress_ctx_t    *stress = &g_stress;
+    storage_stress_cursor_t cursor;
+    boot_state_t            boot_state;
+    test_id_t               test_id;
+    int32_t                 status;
+
+    status = val_api->nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_ID_CURRENT), &test_id,
+                                 sizeof(test_id_t));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    status = val_api->get_boot_flag(&boot_state);
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    status = val_api->nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_CURSOR), &cursor,
+                                 sizeof(storage_stress_cursor_t));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    if ((boot_state == BOOT_EXPECTED_CONT_TEST_EXEC) && (cursor.magic == STORAGE_STRESS_MAGIC)
+        && (cursor.test_id == (uint16_t)test_id))
+    {
+        if (++cursor.resets > STORAGE_STRESS_MAX_RESETS)
+        {
+            val_api->print(PRINT_ERROR, "\tStress reset %d times\n", cursor.resets - 1);
+            return VAL_STATUS_ERROR;
+        }
+        val_api->print(PRINT_TEST, "Resuming round %d after a reset\n", cursor.round);
+    }
+    else
+    {
+        cursor.magic = STORAGE_STRESS_MAGIC;
+        cursor.test_id = (uint16_t)test_id;
+        cursor.seed = STORAGE_STRESS_SEED ? STORAGE_STRESS_SEED : 1;
+        cursor.round = 0;
+        cursor.rng = cursor.seed;
+        cursor.base_stored = 0;
+        cursor.base_fill = 0;
+        cursor.resets = 0;
+    }
+    val_api->print(PRINT_TEST, "Seed 0x%x\n", cursor.seed);
+
+    stress->perf = ctx;
+    storage_stress_cleanup(stress);
+
+    for (; cursor.round < STORAGE_STRESS_ROUNDS; cursor.round++)
+    {
+        /* A reset replays the round from its random state */
+        status = val_api->nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_CURSOR), &cursor,
+                                      sizeof(storage_stress_cursor_t));
+        if (VAL_ERROR(status))
+        {
+            return status;
+        }
+
+        status = val_api->set_boot_flag(BOOT_EXPECTED_CONT_TEST_EXEC);
+        if (VAL_ERROR(status))
+        {
+            return status;
+        }
+
+        stress->rng = cursor.rng;
+        stress->error = PSA_SUCCESS;
+        status = storage_stress_round(val_api, stress, &cursor);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            storage_stress_cleanup(stress);
+            break;
+        }
+        cursor.rng = stress->rng;
+    }
+
+    /* A later reset is not part of the stress */
+    cursor.magic = 0;
+    val_api->nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_CURSOR), &cursor,
+                         sizeof(storage_stress_cursor_t));
+    val_api->set_boot_flag(BOOT_NOT_EXPECTED);
+
+    return status;
+}
@@ -0,0 +1,78 @@
+#/** @file
+# * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+foreach(test ${PSA_TEST_LIST})
+	include(${PSA_SUITE_DIR}/${test}/test.cmake)
+	foreach(source_file ${CC_SOURCE})
+		list(APPEND SUITE_CC_SOURCE
+			${PSA_SUITE_DIR}/${test}/${source_file}
+		)
+	endforeach()
+	foreach(asm_file ${AS_SOURCE})
+		list(APPEND SUITE_AS_SOURCE
+			${PSA_SUITE_DIR}/${test}/${asm_file}
+		)
+	endforeach()
+	unset(CC_SOURCE)
+	unset(AS_SOURCE)
+endforeach()
+
+# Sources shared by the tests of the suite
+list(APPEND SUITE_CC_SOURCE
+	${PSA_SUITE_DIR}/common/test_storage_perf_common.c
+	${PSA_SUITE_DIR}/common/test_storage_stress.c
+	${PSA_SUITE_DIR}/common/test_storage_concurrency.c
+)
+
+# Largest object size, may be lowered with -DSTORAGE_PERF_MAX_OBJ_SIZE=<bytes>
+if(DEFINED STORAGE_PERF_MAX_OBJ_SIZE)
+	add_definitions(-DSTORAGE_PERF_MAX_OBJ_SIZE=${STORAGE_PERF_MAX_OBJ_SIZE})
+endif()
+
+# Stress mode, a run may be replayed or lengthened with -DSTORAGE_STRESS_SEED=<seed>,
+# -DSTORAGE_STRESS_ROUNDS=<rounds> and -DSTORAGE_STRESS_MAX_SIZE=<bytes>
+foreach(stress_option STORAGE_STRESS_ROUNDS STORAGE_STRESS_SEED STORAGE_STRESS_MAX_SIZE)
+	if(DEFINED ${stress_option})
+		add_definitions(-D${stress_option}=${${stress_option}})
+	endif()
+endforeach()
+
+add_library(${PSA_TARGET_TEST_COMBINE_LIB} ${PSA_TEST_COMBINE_LIB_TYPE} ${SUITE_CC_SOURCE} ${SUITE_AS_SOURCE})
+target_compile_options(${PSA_TARGET_TEST_COMBINE_LIB} PRIVATE ${CC_OPTIONS} ${AS_OPTIONS})
+
+# Test related Include directories
+foreach(test ${PSA_TEST_LIST})
+	target_include_directories(${PSA_TARGET_TEST_COMBINE_LIB} PRIVATE ${PSA_SUITE_DIR}/${test})
+endforeach()
+
+# PSA Include directories
+foreach(psa_inc_path ${PSA_INCLUDE_PATHS})
+	target_include_directories(${PSA_TARGET_TEST_COMBINE_LIB} PRIVATE
+                ${psa_inc_path}
+        )
+endforeach()
+
+target_include_directories(${PSA_TARGET_TEST_COMBINE_LIB} PRIVATE
+	${CMAKE_CURRENT_BINARY_DIR}
+	${PSA_SUITE_DIR}/common
+	${PSA_ROOT_DIR}/val/common
+	${PSA_ROOT_DIR}/val/nspe
+	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/common
+	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/crypto
+	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/protected_storage
+	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/internal_trusted_storage
+)
@@ -0,0 +1,41 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_g003.h"
+
+client_test_t test_g003_storage_list[] = {
+    NULL,
+    storage_perf_ps_size_test,
+    NULL,
+};
+
+int32_t storage_perf_ps_size_test(security_t caller)
+{
+    storage_perf_ctx_t      ctx;
+    int32_t                 status;
+
+    storage_perf_init(&ctx, val->ps_function, &storage_perf_ps_api);
+
+    val->print(PRINT_TEST, "[Check 1] PS set and get from 1 byte to the largest size\n", 0);
+    status = storage_perf_size_test(val, &ctx);
+    storage_perf_cleanup(&ctx);
+    STORAGE_PERF_ASSERT_RUN(status, TEST_CHECKPOINT_NUM(1));
+
+    return VAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,44 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_g008.h"
+
+client_test_t test_g008_storage_list[] = {
+    NULL,
+    storage_concurrency_its_test,
+    NULL,
+};
+
+int32_t storage_concurrency_its_test(security_t caller)
+{
+    storage_perf_ctx_t      ctx;
+    int32_t                 status;
+
+    storage_perf_init(&ctx, val->its_function, &storage_perf_its_api);
+
+    val->print(PRINT_TEST, "[Check 1] ITS get from several client threads at once\n", 0);
+    status = storage_concurrency_test(val, &ctx);
+    if (status == VAL_STATUS_UNSUPPORTED)
+    {
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+    TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    return VAL_STATUS_SUCCESS;
+}
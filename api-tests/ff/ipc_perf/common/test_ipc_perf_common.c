@@ -0,0 +1,554 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_ipc_perf_common.h"
+
+#define IPC_PERF_NAME_LEN               32
+
+/* Data passed in and out of the calls */
+static uint8_t ipc_perf_buff[IPC_PERF_MAX_SIZE];
+
+/* Bytes passed by one call, sizes above IPC_PERF_MAX_SIZE are not measured */
+static const uint32_t ipc_perf_sizes[IPC_PERF_NUM_SIZES] = {
+    0, 16, 64, 256, 1024, 4096,
+};
+
+/* Measured operations */
+static int32_t ipc_perf_connect_op(void *arg)
+{
+    ipc_perf_ctx_t          *ctx = (ipc_perf_ctx_t *)arg;
+    psa_handle_t            handle;
+
+    handle = ctx->psa_api->connect(SERVER_BENCHMARK_SID, 1);
+    if (handle <= 0)
+    {
+        return 1;
+    }
+    ctx->psa_api->close(handle);
+    return 0;
+}
+
+static int32_t ipc_perf_call_op(void *arg)
+{
+    ipc_perf_ctx_t          *ctx = (ipc_perf_ctx_t *)arg;
+
+    return (ctx->psa_api->call(ctx->handle, ctx->in_vec, ctx->in_len,
+                               ctx->out_vec, ctx->out_len) != PSA_SUCCESS);
+}
+
+static void ipc_perf_op_name(char *name, security_t caller, char *op)
+{
+    char                    *prefix = (caller == NONSECURE) ? "ns" : "s";
+    uint32_t                i = 0;
+
+    while (*prefix && (i < (IPC_PERF_NAME_LEN - 2)))
+    {
+        name[i++] = *prefix++;
+    }
+    name[i++] = '_';
+    while (*op && (i < (IPC_PERF_NAME_LEN - 1)))
+    {
+        name[i++] = *op++;
+    }
+    name[i] = '\0';
+}
+
+/**
+    @brief    - Measures an operation and prints its [Perf] line. An operation which
+                fails is reported with "failed" instead of the measurement.
+    @param    - val_api : VAL API table of the calling test
+                caller  : World of the caller, given as the prefix of the name
+                op      : Name of the operation
+                alg     : Number of vectors of the call
+                size    : Bytes passed by one call
+                fn      : Operation to measure
+                ctx     : Call of the measurement
+    @return   - VAL_STATUS_UNSUPPORTED if the platform has no cycle counter,
+                an error status if the operation failed
+**/
+static int32_t ipc_perf_run(val_api_t *val_api, security_t caller, char *op, uint32_t alg,
+                            uint32_t size, val_perf_fn_t fn, ipc_perf_ctx_t *ctx)
+{
+    val_perf_result_t       result;
+    char                    name[IPC_PERF_NAME_LEN];
+    int32_t                 status;
+
+    ipc_perf_op_name(name, caller, op);
+
+    status = val_api->perf_measure(fn, ctx, &result);
+    if (status == VAL_STATUS_UNSUPPORTED)
+    {
+        return status;
+    }
+
+    if (VAL_ERROR(status))
+    {
+        val_api->print(PRINT_ALWAYS, "[Perf] op=", 0);
+        val_api->print(PRINT_ALWAYS, name, 0);
+        val_api->print(PRINT_ALWAYS, " alg=0x%x", alg);
+        val_api->print(PRINT_ALWAYS, " size=%d failed\n", size);
+        return status;
+    }
+
+    val_api->perf_report(name, alg, size, &result);
+    return VAL_STATUS_SUCCESS;
+}
+
+static int32_t ipc_perf_open(psa_api_t *psa_api, ipc_perf_ctx_t *ctx)
+{
+    ctx->psa_api = psa_api;
+    ctx->in_len = 0;
+    ctx->out_len = 0;
+    ctx->handle = psa_api->connect(SERVER_BENCHMARK_SID, 1);
+    if (ctx->handle <= 0)
+    {
+        return VAL_STATUS_CONNECTION_FAILED;
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Splits the data of a call over the given number of vectors, the last
+                vector takes what does not divide evenly
+    @param    - vec    : Vectors to fill, psa_invec and psa_outvec share their layout
+                num    : Number of vectors
+                size   : Bytes passed by the call
+    @return   - void
+**/
+static void ipc_perf_split(psa_outvec *vec, uint32_t num, uint32_t size)
+{
+    uint32_t                i, offset = 0;
+
+    for (i = 0; i < num; i++)
+    {
+        vec[i].base = &ipc_perf_buff[offset];
+        vec[i].len = (i == (num - 1)) ? (size - offset) : (size / num);
+        offset += vec[i].len;
+    }
+}
+
+/**
+    @brief    - Measures calls passing data to the benchmark service, for every size
+                and from one to PSA_MAX_IOVEC vectors
+    @param    - val_api : VAL API table of the calling test
+                ctx     : Connected call of the measurement
+                caller  : World of the caller
+                in      : TRUE for input vectors, FALSE for output vectors
+    @return   - val_status_t
+**/
+static int32_t ipc_perf_vector_sweep(val_api_t *val_api, ipc_perf_ctx_t *ctx,
+                                     security_t caller, bool_t in)
+{
+    psa_outvec              vec[PSA_MAX_IOVEC];
+    uint32_t                num, i, j;
+    int32_t                 status;
+
+    for (num = 1; num <= PSA_MAX_IOVEC; num++)
+    {
+        for (i = 0; i < IPC_PERF_NUM_SIZES; i++)
+        {
+            if (ipc_perf_sizes[i] > IPC_PERF_MAX_SIZE)
+            {
+                break;
+            }
+
+            ipc_perf_split(vec, num, ipc_perf_sizes[i]);
+            for (j = 0; j < num; j++)
+            {
+                if (in == TRUE)
+                {
+                    ctx->in_vec[j].base = vec[j].base;
+                    ctx->in_vec[j].len = vec[j].len;
+                }
+                else
+                {
+                    ctx->out_vec[j] = vec[j];
+                }
+            }
+            ctx->in_len = (in == TRUE) ? num : 0;
+            ctx->out_len = (in == TRUE) ? 0 : num;
+
+            status = ipc_perf_run(val_api, caller, (in == TRUE) ? "call_invec" : "call_outvec",
+                                  num, ipc_perf_sizes[i], ipc_perf_call_op, ctx);
+            if (status != VAL_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Measures a connection to the benchmark service and its close
+    @param    - val_api : VAL API table of the calling test
+                psa_api : PSA API table of the calling test
+                caller  : World of the caller
+    @return   - val_status_t
+**/
+int32_t ipc_perf_connect_test(val_api_t *val_api, psa_api_t *psa_api, security_t caller)
+{
+    ipc_perf_ctx_t          ctx;
+
+    ctx.psa_api = psa_api;
+    return ipc_perf_run(val_api, caller, "connect_close", 0, 0, ipc_perf_connect_op, &ctx);
+}
+
+/**
+    @brief    - Measures a call without vectors on an open connection
+    @param    - val_api : VAL API table of the calling test
+                psa_api : PSA API table of the calling test
+                caller  : World of the caller
+    @return   - val_status_t
+**/
+int32_t ipc_perf_call_test(val_api_t *val_api, psa_api_t *psa_api, security_t caller)
+{
+    ipc_perf_ctx_t          ctx;
+    int32_t                 status;
+
+    status = ipc_perf_open(psa_api, &ctx);
+    if (status != VAL_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    status = ipc_perf_run(val_api, caller, "call", 0, 0, ipc_perf_call_op, &ctx);
+    psa_api->close(ctx.handle);
+    return status;
+}
+
+/**
+    @brief    - Measures calls which pass data in to the service
+    @param    - val_api : VAL API table of the calling test
+                psa_api : PSA API table of the calling test
+                caller  : World of the caller
+    @return   - val_status_t
+**/
+int32_t ipc_perf_invec_test(val_api_t *val_api, psa_api_t *psa_api, security_t caller)
+{
+    ipc_perf_ctx_t          ctx;
+    int32_t                 status;
+
+    status = ipc_perf_open(psa_api, &ctx);
+    if (status != VAL_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    status = ipc_perf_vector_sweep(val_api, &ctx, caller, TRUE);
+    psa_api->close(ctx.handle);
+    return status;
+}
+
+/**
+    @brief    - Measures calls which take data out of the service
+    @param    - val_api : VAL API table of the calling test
+                psa_api : PSA API table of the calling test
+                caller  : World of the caller
+    @return   - val_status_t
+**/
+int32_t ipc_perf_outvec_test(val_api_t *val_api, psa_api_t *psa_api, security_t caller)
+{
+    ipc_perf_ctx_t          ctx;
+    int32_t                 status;
+
+    status = ipc_perf_open(psa_api, &ctx);
+    if (status != VAL_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    status = ipc_perf_vector_sweep(val_api, &ctx, caller, FALSE);
+    psa_api->close(ctx.handle);
+    return status;
+}
+
+#if defined(NONSECURE_TEST_BUILD) && defined(CONCURRENCY_STRESS_THREADS)
+/* Operation of every client thread, a connection with a call without vectors */
+static int32_t ipc_perf_client_op(void *arg, uint32_t thread)
+{
+    psa_api_t               *psa_api = (psa_api_t *)arg;
+    psa_handle_t            handle;
+    psa_status_t            status;
+
+    (void)thread;
+    handle = psa_api->connect(SERVER_BENCHMARK_SID, 1);
+    if (handle <= 0)
+    {
+        return 1;
+    }
+    status = psa_api->call(handle, NULL, 0, NULL, 0);
+    psa_api->close(handle);
+    return (status != PSA_SUCCESS);
+}
+#endif
+
+/**
+    @brief    - Runs connect, call and close from 1, 2, 4 and up to
+                CONCURRENCY_STRESS_THREADS Non-secure client threads at once, and prints
+                a [Stress] line for every number of threads. A client thread which is
+                starved of the service fails the test, errors of the operations are
+                only reported.
+    @param    - val_api : VAL API table of the calling test
+                psa_api : PSA API table of the calling test
+    @return   - VAL_STATUS_UNSUPPORTED if the stress is off, the caller is Secure or the
+                platform has no threads or no cycle counter, VAL_STATUS_ERROR if a
+                thread was starved
+**/
+int32_t ipc_perf_concurrency_test(val_api_t *val_api, psa_api_t *psa_api)
+{
+#if defined(NONSECURE_TEST_BUILD) && defined(CONCURRENCY_STRESS_THREADS)
+    val_stress_result_t     result;
+    uint32_t                max_threads, threads = 1;
+    int32_t                 status = VAL_STATUS_SUCCESS;
+
+    max_threads = (CONCURRENCY_STRESS_THREADS < VAL_STRESS_MAX_THREADS) ?
+                   CONCURRENCY_STRESS_THREADS : VAL_STRESS_MAX_THREADS;
+
+    while (threads <= max_threads)
+    {
+        status = val_api->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        if (VAL_ERROR(status))
+        {
+            return status;
+        }
+
+        status = val_api->stress_run(ipc_perf_client_op, psa_api, threads, &result);
+        if (status == VAL_STATUS_UNSUPPORTED)
+        {
+            val_api->print(PRINT_TEST, "No threads or cycle counter on the platform\n", 0);
+            return status;
+        }
+        if (VAL_ERROR(status))
+        {
+            return status;
+        }
+
+        val_api->stress_report("ns_connect_call_close", &result);
+        if (result.starved > 0)
+        {
+            val_api->print(PRINT_ERROR, "%d client thread(s) starved\n", result.starved);
+            return VAL_STATUS_ERROR;
+        }
+
+        /* 1, 2, 4 and so on, the last run is on all the threads */
+        if (threads == max_threads)
+        {
+            break;
+        }
+        threads = ((threads * 2) < max_threads) ? (threads * 2) : max_threads;
+    }
+    return VAL_STATUS_SUCCESS;
+#else
+    (void)psa_api;
+    val_api->print(PRINT_TEST, "Concurrency stress runs on Non-secure threads, build with "
+                   "-DCONCURRENCY_STRESS_THREADS=<threads>\n", 0);
+    return VAL_STATUS_UNSUPPORTED;
+#endif
+}
+
+/**
+    @brief    - Prints a latency of the interrupt measurement as one [Irq] line, in
+                nanoseconds too if the counter rate is known
+    @param    - val_api : VAL API table of the calling test
+                op      : Name of the latency
+                result  : Measurement of the driver partition
+                min     : Shortest, mean and longest cycles
+                p99     : 99th percentile of the cycles, NULL if not measured
+    @return   - void
+**/
+static void ipc_perf_irq_report(val_api_t *val_api, char *op, val_irq_latency_t *result,
+                                uint32_t min, uint32_t mean, uint32_t *p99, uint32_t max)
+{
+    val_api->print(PRINT_ALWAYS, "[Irq] op=", 0);
+    val_api->print(PRINT_ALWAYS, op, 0);
+    val_api->print(PRINT_ALWAYS, " iterations=%d", result->iterations);
+    val_api->print(PRINT_ALWAYS, " min_cycles=%d", min);
+    val_api->print(PRINT_ALWAYS, " mean_cycles=%d", mean);
+    if (p99 != NULL)
+    {
+        val_api->print(PRINT_ALWAYS, " p99_cycles=%d", *p99);
+    }
+    val_api->print(PRINT_ALWAYS, " max_cycles=%d", max);
+    if (result->freq_hz)
+    {
+        val_api->print(PRINT_ALWAYS, " mean_ns=%d",
+                       (int32_t)(((uint64_t)mean * 1000000000) / result->freq_hz));
+        if (p99 != NULL)
+        {
+            val_api->print(PRINT_ALWAYS, " p99_ns=%d",
+                           (int32_t)(((uint64_t)*p99 * 1000000000) / result->freq_hz));
+        }
+        val_api->print(PRINT_ALWAYS, " max_ns=%d",
+                       (int32_t)(((uint64_t)max * 1000000000) / result->freq_hz));
+    }
+    val_api->print(PRINT_ALWAYS, "\n", 0);
+}
+
+/**
+    @brief    - Has the driver partition measure the latency of its interrupt over
+                IPC_PERF_IRQ_ITERATIONS interrupts, then prints the trigger to psa_wait
+                and the psa_eoi latencies and the histogram of the first one
+    @param    - val_api : VAL API table of the calling test
+                psa_api : PSA API table of the calling test
+    @return   - VAL_STATUS_UNSUPPORTED if the platform has no cycle counter,
+                an error status if the measurement failed
+**/
+int32_t ipc_perf_irq_test(val_api_t *val_api, psa_api_t *psa_api)
+{
+    driver_test_fn_id_t     driver_test_fn_id = TEST_IRQ_LATENCY;
+    uint32_t                iterations = IPC_PERF_IRQ_ITERATIONS;
+    val_irq_latency_t       result;
+    psa_handle_t            handle;
+    psa_status_t            status;
+    uint32_t                i, rank, count = 0, p99 = 0, low;
+
+    psa_invec invec[2] = {{&driver_test_fn_id, sizeof(driver_test_fn_id)},
+                          {&iterations, sizeof(iterations)}};
+    psa_outvec outvec[1] = {{&result, sizeof(result)}};
+
+    handle = psa_api->connect(DRIVER_TEST_SID, 1);
+    if (handle <= 0)
+    {
+        return VAL_STATUS_CONNECTION_FAILED;
+    }
+    status = psa_api->call(handle, invec, 2, outvec, 1);
+    psa_api->close(handle);
+    if (status == VAL_STATUS_UNSUPPORTED)
+    {
+        return VAL_STATUS_UNSUPPORTED;
+    }
+    if (status != PSA_SUCCESS)
+    {
+        return VAL_STATUS_CALL_FAILED;
+    }
+
+    /* The bucket of bit length i holds the latencies of up to 2^i - 1 cycles */
+    rank = (uint32_t)(((uint64_t)result.iterations * 99 + 99) / 100);
+    for (i = 0; i < VAL_IRQ_HIST_BUCKETS; i++)
+    {
+        count += result.hist[i];
+        if (count >= rank)
+        {
+            p99 = (i < 32) ? ((1U << i) - 1) : UINT32_MAX;
+            break;
+        }
+    }
+    p99 = (p99 > result.wait_max) ? result.wait_max : p99;
+
+    ipc_perf_irq_report(val_api, "trigger_to_wait", &result, result.wait_min, result.wait_mean,
+                        &p99, result.wait_max);
+    ipc_perf_irq_report(val_api, "eoi", &result, result.eoi_min, result.eoi_mean, NULL,
+                        result.eoi_max);
+
+    for (i = 0; i < VAL_IRQ_HIST_BUCKETS; i++)
+    {
+        if (result.hist[i] == 0)
+        {
+            continue;
+        }
+        low = (i == 0) ? 0 : (1U << (i - 1));
+        val_api->print(PRINT_ALWAYS, "[Irq] hist cycles=%d", low);
+        val_api->print(PRINT_ALWAYS, "-%d", (i < 32) ? ((1U << i) - 1) : result.wait_max);
+        val_api->print(PRINT_ALWAYS, " count=%d\n", result.hist[i]);
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+#ifndef NONSECURE_TEST_BUILD
+/* One round trip, the server partition answers the doorbell with a doorbell. Under load
+   a call to the benchmark service is queued to the server partition with each doorbell. */
+static int32_t ipc_perf_doorbell_op(void *arg)
+{
+    ipc_perf_ctx_t          *ctx = (ipc_perf_ctx_t *)arg;
+
+    ctx->psa_api->notify(SERVER_PARTITION);
+    if ((ctx->handle > 0) &&
+        (ctx->psa_api->call(ctx->handle, NULL, 0, NULL, 0) != PSA_SUCCESS))
+    {
+        return 1;
+    }
+    if ((ctx->psa_api->wait(PSA_DOORBELL, PSA_BLOCK) & PSA_DOORBELL) == 0)
+    {
+        return 1;
+    }
+    ctx->psa_api->clear();
+    return 0;
+}
+#endif
+
+/**
+    @brief    - Measures doorbell round trips between the client and the server
+                partitions, which answers each psa_notify with a psa_notify, and prints
+                the round trips and the wake-ups, two for each round trip
+    @param    - val_api : VAL API table of the calling test
+                psa_api : PSA API table of the calling test
+                load    : TRUE to also call the benchmark service with every doorbell
+    @return   - VAL_STATUS_UNSUPPORTED if the caller is Non-secure or the platform has
+                no cycle counter, an error status if the measurement failed
+**/
+int32_t ipc_perf_doorbell_test(val_api_t *val_api, psa_api_t *psa_api, bool_t load)
+{
+#ifndef NONSECURE_TEST_BUILD
+    ipc_perf_ctx_t          ctx;
+    val_perf_result_t       result;
+    psa_handle_t            handle;
+    int32_t                 status;
+
+    /* The connection starts the responder of the server partition, its close stops it */
+    handle = psa_api->connect(SERVER_UNSPECIFED_MINOR_V_SID, 1);
+    if (handle <= 0)
+    {
+        return VAL_STATUS_CONNECTION_FAILED;
+    }
+
+    /* A doorbell left by an earlier test would be taken for the first answer */
+    psa_api->clear();
+
+    ctx.psa_api = psa_api;
+    ctx.handle = PSA_NULL_HANDLE;
+    if (load == TRUE)
+    {
+        ctx.handle = psa_api->connect(SERVER_BENCHMARK_SID, 1);
+        if (ctx.handle <= 0)
+        {
+            psa_api->close(handle);
+            return VAL_STATUS_CONNECTION_FAILED;
+        }
+    }
+
+    status = val_api->perf_measure(ipc_perf_doorbell_op, &ctx, &result);
+    if (status == VAL_STATUS_SUCCESS)
+    {
+        val_api->perf_report("s_doorbell_round_trip", (load == TRUE), 0, &result);
+        result.iterations *= 2;
+        val_api->perf_report("s_doorbell_wakeup", (load == TRUE), 0, &result);
+    }
+
+    if (ctx.handle > 0)
+    {
+        psa_api->close(ctx.handle);
+    }
+    psa_api->close(handle);
+    return status;
+#else
+    (void)psa_api;
+    (void)load;
+    val_api->print(PRINT_TEST, "Doorbells are signals between secure partitions\n", 0);
+    return VAL_STATUS_UNSUPPORTED;
+#endif
+}
@@ -0,0 +1,70 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _TEST_IPC_PERF_COMMON_H_
+#define _TEST_IPC_PERF_COMMON_H_
+
+#ifdef NONSECURE_TEST_BUILD
+#include "val_interfaces.h"
+#include "val_target.h"
+#else
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#endif
+
+/* Largest amount of data passed by one call, may be lowered for targets with little RAM */
+#ifndef IPC_PERF_MAX_SIZE
+#define IPC_PERF_MAX_SIZE               4096
+#endif
+
+#define IPC_PERF_NUM_SIZES              6
+
+/* Interrupts of the latency measurement of the driver partition */
+#ifndef IPC_PERF_IRQ_ITERATIONS
+#define IPC_PERF_IRQ_ITERATIONS         4096
+#endif
+
+/* State shared by the measured operations */
+typedef struct {
+    psa_api_t       *psa_api;
+    psa_handle_t    handle;
+    psa_invec       in_vec[PSA_MAX_IOVEC];
+    psa_outvec      out_vec[PSA_MAX_IOVEC];
+    size_t          in_len;
+    size_t          out_len;
+} ipc_perf_ctx_t;
+
+#define IPC_PERF_ASSERT_RUN(status, checkpoint)                                     \
+    do {                                                                            \
+        if ((status) == VAL_STATUS_UNSUPPORTED)                                     \
+        {                                                                           \
+            val->print(PRINT_TEST, "No cycle counter on the platform\n", 0);         \
+            return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);                             \
+        }                                                                           \
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, checkpoint);                  \
+    } while (0)
+
+int32_t ipc_perf_connect_test(val_api_t *val_api, psa_api_t *psa_api, security_t caller);
+int32_t ipc_perf_call_test(val_api_t *val_api, psa_api_t *psa_api, security_t caller);
+int32_t ipc_perf_invec_test(val_api_t *val_api, psa_api_t *psa_api, security_t caller);
+int32_t ipc_perf_outvec_test(val_api_t *val_api, psa_api_t *psa_api, security_t caller);
+int32_t ipc_perf_concurrency_test(val_api_t *val_api, psa_api_t *psa_api);
+int32_t ipc_perf_irq_test(val_api_t *val_api, psa_api_t *psa_api);
+int32_t ipc_perf_doorbell_test(val_api_t *val_api, psa_api_t *psa_api, bool_t load);
+int32_t server_test_ipc_perf(void);
+int32_t server_test_ipc_perf_doorbell(void);
+#endif /* _TEST_IPC_PERF_COMMON_H_ */
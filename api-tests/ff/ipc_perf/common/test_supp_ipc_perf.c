@@ -0,0 +1,98 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#include "test_ipc_perf_common.h"
+
+#define val CONCAT(val,_server_sp)
+#define psa CONCAT(psa,_server_sp)
+extern val_api_t *val;
+extern psa_api_t *psa;
+
+/**
+    @brief    - Server side of every check of the suite. The benchmark service is served
+                by the main loop of the server partition, so this only hands it back.
+    @param    - void
+    @return   - val_status_t
+**/
+int32_t server_test_ipc_perf(void)
+{
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Server side of the doorbell round trips. Answers each doorbell of the
+                client partition with a doorbell, and serves the calls to the benchmark
+                service of the load, until the client closes its connection.
+    @param    - void
+    @return   - val_status_t
+**/
+int32_t server_test_ipc_perf_doorbell(void)
+{
+    psa_signal_t            signals;
+    psa_msg_t               msg = {0};
+    int32_t                 client;
+    val_status_t            status;
+
+    status = val->process_connect_request(SERVER_UNSPECIFED_MINOR_V_SIG, &msg);
+    if (VAL_ERROR(status))
+    {
+        psa->reply(msg.handle, PSA_ERROR_CONNECTION_REFUSED);
+        return status;
+    }
+    if (msg.client_id <= 0)
+    {
+        val->print(PRINT_ERROR, "Doorbell client is Non-secure\n", 0);
+        psa->reply(msg.handle, PSA_ERROR_CONNECTION_REFUSED);
+        return VAL_STATUS_SPM_FAILED;
+    }
+    client = msg.client_id;
+
+    /* A doorbell left by an earlier test would be taken for the first round trip */
+    psa->clear();
+    psa->reply(msg.handle, PSA_SUCCESS);
+
+    while (1)
+    {
+        signals = psa->wait(PSA_DOORBELL | SERVER_BENCHMARK_SIG | SERVER_UNSPECIFED_MINOR_V_SIG,
+                            PSA_BLOCK);
+
+        if (signals & PSA_DOORBELL)
+        {
+            psa->clear();
+            psa->notify(client);
+        }
+
+        /* Connect, call and close of the load are all accepted */
+        if ((signals & SERVER_BENCHMARK_SIG) &&
+            (psa->get(SERVER_BENCHMARK_SIG, &msg) == PSA_SUCCESS))
+        {
+            psa->reply(msg.handle, PSA_SUCCESS);
+        }
+
+        if ((signals & SERVER_UNSPECIFED_MINOR_V_SIG) &&
+            (psa->get(SERVER_UNSPECIFED_MINOR_V_SIG, &msg) == PSA_SUCCESS))
+        {
+            psa->reply(msg.handle, PSA_SUCCESS);
+            if (msg.type == PSA_IPC_DISCONNECT)
+            {
+                return VAL_STATUS_SUCCESS;
+            }
+        }
+    }
+}
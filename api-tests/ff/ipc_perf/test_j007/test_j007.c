@@ -0,0 +1,55 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifdef NONSECURE_TEST_BUILD
+#include "val_interfaces.h"
+#include "val_target.h"
+#else
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#endif
+
+#include "test_j007.h"
+
+client_test_t test_j007_client_tests_list[] = {
+    NULL,
+    client_test_ipc_perf_doorbell,
+    client_test_ipc_perf_doorbell_load,
+    NULL,
+};
+
+int32_t client_test_ipc_perf_doorbell(security_t caller)
+{
+    int32_t         status;
+
+    val->print(PRINT_TEST, "[Check 1] psa_notify and psa_wait round trips with the server\n", 0);
+    status = ipc_perf_doorbell_test(val, psa, FALSE);
+    IPC_PERF_ASSERT_RUN(status, TEST_CHECKPOINT_NUM(1));
+
+    return VAL_STATUS_SUCCESS;
+}
+
+int32_t client_test_ipc_perf_doorbell_load(security_t caller)
+{
+    int32_t         status;
+
+    val->print(PRINT_TEST, "[Check 2] Round trips with a call to the server on each\n", 0);
+    status = ipc_perf_doorbell_test(val, psa, TRUE);
+    IPC_PERF_ASSERT_RUN(status, TEST_CHECKPOINT_NUM(2));
+
+    return VAL_STATUS_SUCCESS;
+}
@@ -34,6 +34,9 @@ void driver_test_isolation_psa_rot_heap_rd(psa_msg_t *msg);
 void driver_test_isolation_psa_rot_heap_wr(psa_msg_t *msg);
 void driver_test_isolation_psa_rot_mmio_rd(psa_msg_t *msg);
 void driver_test_isolation_psa_rot_mmio_wr(psa_msg_t *msg);
+void driver_cycle_counter_read(psa_msg_t *msg);
+void driver_test_irq_latency(psa_msg_t *msg);
+val_status_t driver_uart_print_batch(psa_msg_t *msg, char *string, size_t size);
 
 void driver_main(void)
 {
@@ -43,7 +46,7 @@ void driver_main(void)
     uart_fn_type_t        uart_fn;
     nvmem_param_t         nvmem_param;
     driver_test_fn_id_t   driver_test_fn_id;
-    char                  string[256] = {0};
+    char                  string[PAL_PRINT_STRING_SIZE] = {0};
     uint8_t               buffer[256] = {0};
     wd_param_t            wd_param;
     addr_t                uart_base;
@@ -86,10 +89,16 @@ void driver_main(void)
                         psa_read(msg.handle, 1, &uart_base, msg.in_size[1]);
                         fn_status = val_uart_init_sf(uart_base);
                     }
+                    else if (uart_fn == UART_PRINT_BATCH)
+                    {
+                        /* arg2=print records */
+                        fn_status = driver_uart_print_batch(&msg, string, sizeof(string));
+                    }
                     else
                     {
-                        /* arg2=string, arg3=DATA */
-                        psa_read(msg.handle, 1, &string, msg.in_size[1]);
+                        /* arg2=string, arg3=DATA. A longer string is truncated */
+                        psa_read(msg.handle, 1, &string, sizeof(string));
+                        string[sizeof(string) - 1] = '\0';
                         psa_read(msg.handle, 2, &data, msg.in_size[2]);
                         fn_status = val_print_sf(string, data);
                     }
@@ -283,6 +292,12 @@ void driver_main(void)
                         case TEST_ISOLATION_PSA_ROT_MMIO_WR:
                              driver_test_isolation_psa_rot_mmio_wr(&msg);
                              break;
+                        case TEST_CYCLE_COUNTER_READ:
+                             driver_cycle_counter_read(&msg);
+                             break;
+                        case TEST_IRQ_LATENCY:
+                             driver_test_irq_latency(&msg);
+                             break;
                     }
                     break;
                 case PSA_IPC_CONNECT:
@@ -300,6 +315,92 @@ void driver_main(void)
     }
 }
 
+/**
+    @brief    - Reads the cycle counter for the secure performance tests. The counter
+                value is written to outvec 0 and its frequency in Hz, 0 if not known,
+                to outvec 1 if given.
+    @param    - msg      : TEST_CYCLE_COUNTER_READ request message
+    @return   - void
+**/
+void driver_cycle_counter_read(psa_msg_t *msg)
+{
+    uint32_t    cycles, freq_hz;
+
+    if ((msg->out_size[0] < sizeof(cycles)) ||
+        ((msg->out_size[1] != 0) && (msg->out_size[1] < sizeof(freq_hz))))
+    {
+        psa_reply(msg->handle, VAL_STATUS_INVALID);
+        return;
+    }
+
+    if (VAL_ERROR(val_cycle_counter_init_sf(&freq_hz)))
+    {
+        psa_reply(msg->handle, VAL_STATUS_UNSUPPORTED);
+        return;
+    }
+
+    /* Read last, so that the counter value is as close as possible to the reply */
+    if (msg->out_size[1] != 0)
+    {
+        psa_write(msg->handle, 1, &freq_hz, sizeof(freq_hz));
+    }
+    cycles = val_cycle_counter_read_sf();
+    psa_write(msg->handle, 0, &cycles, sizeof(cycles));
+    psa_reply(msg->handle, PSA_SUCCESS);
+}
+
+/**
+    @brief    - Prints the records of a UART_PRINT_BATCH request. Each record is an
+                uart_print_rec_t header followed by its NUL terminated string. A string
+                longer than the buffer is truncated, and the following records are
+                still printed.
+    @param    - msg      : UART_PRINT_BATCH request message
+              - string   : Buffer to read the record string into
+              - size     : Size of the string buffer
+    @return   - val_status_t
+**/
+val_status_t driver_uart_print_batch(psa_msg_t *msg, char *string, size_t size)
+{
+    uart_print_rec_t    rec;
+    size_t              remaining = msg->in_size[1];
+    size_t              len;
+    val_status_t        status = VAL_STATUS_SUCCESS;
+
+    while (remaining >= sizeof(rec))
+    {
+        if (psa_read(msg->handle, 1, &rec, sizeof(rec)) != sizeof(rec))
+        {
+            return VAL_STATUS_READ_FAILED;
+        }
+        remaining -= sizeof(rec);
+
+        if ((rec.str_len == 0) || (rec.str_len > remaining))
+        {
+            return VAL_STATUS_INVALID_SIZE;
+        }
+
+        len = (rec.str_len > size) ? size : rec.str_len;
+        if (psa_read(msg->handle, 1, string, len) != len)
+        {
+            return VAL_STATUS_READ_FAILED;
+        }
+        if (len < rec.str_len)
+        {
+            psa_skip(msg->handle, 1, rec.str_len - len);
+        }
+        remaining -= rec.str_len;
+        string[len - 1] = '\0';
+
+        status = val_print_sf(string, rec.data);
+        if (VAL_ERROR(status))
+        {
+            return status;
+        }
+    }
+
+    return status;
+}
+
 int32_t driver_test_psa_eoi_with_non_intr_signal(void)
 {
     /* Setting boot.state before test check */
@@ -439,6 +540,94 @@ int32_t driver_test_irq_routing(void)
     }
 }
 
+/**
+    @brief    - Measures the latency of the interrupt of the driver partition. Each
+                iteration triggers the interrupt, waits for its signal with psa_wait,
+                clears the source and ends the interrupt with psa_eoi. The number of
+                iterations is read from invec 1, the val_irq_latency_t result is
+                written to outvec 0.
+    @param    - msg      : TEST_IRQ_LATENCY request message
+    @return   - void
+**/
+void driver_test_irq_latency(psa_msg_t *msg)
+{
+    val_irq_latency_t   result;
+    uint64_t            wait_sum = 0, eoi_sum = 0;
+    uint32_t            i, start, wait, eoi, bucket;
+
+    memset(&result, 0, sizeof(result));
+    if ((msg->in_size[1] != sizeof(result.iterations)) || (msg->out_size[0] < sizeof(result)))
+    {
+        psa_reply(msg->handle, VAL_STATUS_INVALID);
+        return;
+    }
+
+    psa_read(msg->handle, 1, &result.iterations, sizeof(result.iterations));
+    if (result.iterations == 0)
+    {
+        psa_reply(msg->handle, VAL_STATUS_INVALID);
+        return;
+    }
+
+    if (VAL_ERROR(val_cycle_counter_init_sf(&result.freq_hz)))
+    {
+        psa_reply(msg->handle, VAL_STATUS_UNSUPPORTED);
+        return;
+    }
+
+    /* The cheapest of a few reads in a row, in case one of them is interrupted */
+    result.overhead = UINT32_MAX;
+    for (i = 0; i < VAL_PERF_READ_RUNS; i++)
+    {
+        start = val_cycle_counter_read_sf();
+        wait = val_cycle_counter_read_sf() - start;
+        result.overhead = (wait < result.overhead) ? wait : result.overhead;
+    }
+
+    result.wait_min = UINT32_MAX;
+    result.eoi_min = UINT32_MAX;
+    for (i = 0; i < result.iterations; i++)
+    {
+        start = val_cycle_counter_read_sf();
+        val_generate_interrupt();
+        if ((psa_wait(DRIVER_UART_INTR_SIG, PSA_BLOCK) & DRIVER_UART_INTR_SIG) == 0)
+        {
+            val_disable_interrupt();
+            val_print_sf("\tFailed to receive irq signal\n", 0);
+            psa_reply(msg->handle, VAL_STATUS_SPM_FAILED);
+            return;
+        }
+        wait = val_cycle_counter_read_sf() - start;
+
+        /* The source is cleared before the end of interrupt, as in driver_test_irq_routing */
+        val_disable_interrupt();
+        start = val_cycle_counter_read_sf();
+        psa_eoi(DRIVER_UART_INTR_SIG);
+        eoi = val_cycle_counter_read_sf() - start;
+
+        wait = (wait > result.overhead) ? (wait - result.overhead) : 0;
+        eoi = (eoi > result.overhead) ? (eoi - result.overhead) : 0;
+        wait_sum += wait;
+        eoi_sum += eoi;
+        result.wait_min = (wait < result.wait_min) ? wait : result.wait_min;
+        result.wait_max = (wait > result.wait_max) ? wait : result.wait_max;
+        result.eoi_min = (eoi < result.eoi_min) ? eoi : result.eoi_min;
+        result.eoi_max = (eoi > result.eoi_max) ? eoi : result.eoi_max;
+
+        bucket = 0;
+        while ((bucket < (VAL_IRQ_HIST_BUCKETS - 1)) && (wait >> bucket))
+        {
+            bucket++;
+        }
+        result.hist[bucket]++;
+    }
+    result.wait_mean = (uint32_t)(wait_sum / result.iterations);
+    result.eoi_mean = (uint32_t)(eoi_sum / result.iterations);
+
+    psa_write(msg->handle, 0, &result, sizeof(result));
+    psa_reply(msg->handle, PSA_SUCCESS);
+}
+
 static int32_t process_call_request(psa_signal_t sig, psa_msg_t *msg)
 {
     val_status_t res = VAL_STATUS_ERROR;
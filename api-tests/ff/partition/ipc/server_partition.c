@@ -20,6 +20,53 @@
 val_api_t *val_server_sp = &val_api;
 psa_api_t *psa_server_sp = &psa_api;
 
+#ifdef SERVER_BENCHMARK_SIG
+static uint8_t server_benchmark_buffer[SERVER_BENCHMARK_BUFFER_SIZE];
+
+/**
+    @brief    - Serves the benchmark RoT service of the IPC performance suite. A call
+                reads all of its input vectors and fills all of its output vectors,
+                like a service which copies its parameters in and out, then succeeds.
+    @param    - msg : Message of SERVER_BENCHMARK_SIG
+    @return   - void
+**/
+static void server_benchmark(psa_msg_t *msg)
+{
+    size_t      remaining, chunk;
+    uint32_t    i;
+
+    if (msg->type == PSA_IPC_CALL)
+    {
+        for (i = 0; i < PSA_MAX_IOVEC; i++)
+        {
+            remaining = msg->in_size[i];
+            while (remaining > 0)
+            {
+                chunk = psa_read(msg->handle, i, server_benchmark_buffer,
+                                 sizeof(server_benchmark_buffer));
+                if (chunk == 0)
+                {
+                    break;
+                }
+                remaining -= chunk;
+            }
+
+            remaining = msg->out_size[i];
+            while (remaining > 0)
+            {
+                chunk = (remaining < sizeof(server_benchmark_buffer)) ?
+                         remaining : sizeof(server_benchmark_buffer);
+                psa_write(msg->handle, i, server_benchmark_buffer, chunk);
+                remaining -= chunk;
+            }
+        }
+    }
+
+    /* Connect and disconnect are always accepted */
+    psa_reply(msg->handle, PSA_SUCCESS);
+}
+#endif
+
 void server_main(void)
 {
     uint32_t        test_data = 0;
@@ -65,6 +112,19 @@ void server_main(void)
 
                     if (GET_ACTION_NUM(test_data) == TEST_EXECUTE_FUNC)
                     {
+                        /* A dispatcher connection carries the check blocks of one test,
+                           its number is kept in the reverse handle of the connection */
+                        if (msg.rhandle == NULL)
+                        {
+                            psa_set_rhandle(msg.handle,
+                                            (void *)(uintptr_t)GET_TEST_NUM(test_data));
+                        }
+                        else if ((uintptr_t)msg.rhandle != GET_TEST_NUM(test_data))
+                        {
+                            val_print(PRINT_ERROR, "dispatcher connection of another test\n", 0);
+                            psa_reply(msg.handle, PSA_ERROR_CONNECTION_REFUSED);
+                            break;
+                        }
                         psa_reply(msg.handle, PSA_SUCCESS);
                         val_print(PRINT_INFO,"\tSERVER TEST FUNC START %d\n",
                                                     GET_BLOCK_NUM(test_data));
@@ -97,6 +157,13 @@ void server_main(void)
                     TEST_PANIC();
             }
         }
+#ifdef SERVER_BENCHMARK_SIG
+        else if (signals & SERVER_BENCHMARK_SIG)
+        {
+            psa_get(SERVER_BENCHMARK_SIG, &msg);
+            server_benchmark(&msg);
+        }
+#endif
         else
         {
             val_print(PRINT_ERROR, "In server_partition, Control shouldn't have reach here\n", 0);
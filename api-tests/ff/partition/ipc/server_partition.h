@@ -22,6 +22,9 @@
 
 typedef server_test_t (*server_test_list_t);
 
+/* Data of the benchmark service calls is read and written in chunks of this size */
+#define SERVER_BENCHMARK_BUFFER_SIZE    1024
+
 #include "server_tests_list_declare.inc"
 
 server_test_list_t server_ipc_test_list[] = {
@@ -0,0 +1,53 @@
+/** @file
+ * Copyright (c) 2018-2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "pal_dwt.h"
+
+/**
+    @brief           - Enables the DWT cycle counter
+    @param           - void
+    @return          - 0 if the counter is running, 1 if it is not implemented
+**/
+int pal_dwt_cycle_counter_init(void)
+{
+    volatile uint32_t   delay;
+    uint32_t            start;
+
+    DEMCR |= DEMCR_TRCENA_Msk;
+    if (DWT_CTRL & DWT_CTRL_NOCYCCNT_Msk)
+    {
+        return 1;
+    }
+
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    /* Models may implement the register without counting */
+    start = DWT_CYCCNT;
+    for (delay = 0; delay < 16; delay++);
+
+    return (DWT_CYCCNT == start) ? 1 : 0;
+}
+
+/**
+    @brief           - Reads the DWT cycle counter
+    @param           - void
+    @return          - Number of CPU cycles, wraps around at 32 bits
+**/
+uint32_t pal_dwt_cycle_counter_read(void)
+{
+    return DWT_CYCCNT;
+}
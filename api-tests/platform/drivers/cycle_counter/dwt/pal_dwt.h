@@ -0,0 +1,41 @@
+/** @file
+ * Copyright (c) 2018-2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _PAL_DWT_H_
+#define _PAL_DWT_H_
+
+#include "pal_common.h"
+
+/* Armv7-M/Armv8-M Mainline Data Watchpoint and Trace unit */
+#define DWT_CTRL                       (*(volatile uint32_t *)0xE0001000UL)
+#define DWT_CYCCNT                     (*(volatile uint32_t *)0xE0001004UL)
+#define DEMCR                          (*(volatile uint32_t *)0xE000EDFCUL)
+
+/* DWT CTRL Register Definitions */
+#define DWT_CTRL_CYCCNTENA_Pos          0          /* DWT CTRL: CYCCNTENA Position */
+#define DWT_CTRL_CYCCNTENA_Msk         (0x1UL << DWT_CTRL_CYCCNTENA_Pos)
+#define DWT_CTRL_NOCYCCNT_Pos           25         /* DWT CTRL: NOCYCCNT Position */
+#define DWT_CTRL_NOCYCCNT_Msk          (0x1UL << DWT_CTRL_NOCYCCNT_Pos)
+
+/* DEMCR Register Definitions */
+#define DEMCR_TRCENA_Pos                24         /* DEMCR: TRCENA Position */
+#define DEMCR_TRCENA_Msk               (0x1UL << DEMCR_TRCENA_Pos)
+
+int pal_dwt_cycle_counter_init(void);
+uint32_t pal_dwt_cycle_counter_read(void);
+
+#endif /* _PAL_DWT_H_ */
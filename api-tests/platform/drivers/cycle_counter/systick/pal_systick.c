@@ -0,0 +1,61 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "pal_systick.h"
+
+/* The 24-bit down counter is extended to 32 bits in software */
+static uint32_t systick_last;
+static uint32_t systick_count;
+
+/**
+    @brief           - Starts SysTick as a free running counter of the processor clock,
+                       without interrupt. Used where the DWT cycle counter is not
+                       implemented, e.g. on Armv8-M Baseline.
+    @param           - void
+    @return          - 0 if the counter is running, 1 if SysTick is already in use
+**/
+int pal_systick_counter_init(void)
+{
+    if (SYST_CSR & SYST_CSR_ENABLE_Msk)
+    {
+        /* Started by us on a previous call, or owned by the OS tick */
+        return (SYST_RVR == SYST_RVR_MAX) ? 0 : 1;
+    }
+
+    SYST_RVR = SYST_RVR_MAX;
+    SYST_CVR = 0;
+    SYST_CSR = SYST_CSR_CLKSOURCE_Msk | SYST_CSR_ENABLE_Msk;
+
+    systick_last = SYST_CVR;
+    systick_count = 0;
+    return 0;
+}
+
+/**
+    @brief           - Reads the extended SysTick counter. The counter must be read at
+                       least once per 2^24 cycles for the count to stay accurate.
+    @param           - void
+    @return          - Number of CPU cycles, wraps around at 32 bits
+**/
+uint32_t pal_systick_counter_read(void)
+{
+    uint32_t    now = SYST_CVR;
+
+    systick_count += (systick_last - now) & SYST_RVR_MAX;
+    systick_last = now;
+    return systick_count;
+}
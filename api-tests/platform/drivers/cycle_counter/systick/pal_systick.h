@@ -0,0 +1,39 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _PAL_SYSTICK_H_
+#define _PAL_SYSTICK_H_
+
+#include "pal_common.h"
+
+/* SysTick timer, also present on Armv6-M and Armv8-M Baseline */
+#define SYST_CSR                       (*(volatile uint32_t *)0xE000E010UL)
+#define SYST_RVR                       (*(volatile uint32_t *)0xE000E014UL)
+#define SYST_CVR                       (*(volatile uint32_t *)0xE000E018UL)
+
+/* SYST CSR Register Definitions */
+#define SYST_CSR_ENABLE_Pos             0          /* SYST CSR: ENABLE Position */
+#define SYST_CSR_ENABLE_Msk            (0x1UL << SYST_CSR_ENABLE_Pos)
+#define SYST_CSR_CLKSOURCE_Pos          2          /* SYST CSR: CLKSOURCE Position */
+#define SYST_CSR_CLKSOURCE_Msk         (0x1UL << SYST_CSR_CLKSOURCE_Pos)
+
+#define SYST_RVR_MAX                    0x00FFFFFFUL
+
+int pal_systick_counter_init(void);
+uint32_t pal_systick_counter_read(void);
+
+#endif /* _PAL_SYSTICK_H_ */
@@ -17,6 +17,97 @@
 
 #include "pal_nvmem.h"
 
+#ifdef NVMEM_FLASH_ERASE_SIZE
+static uint8_t nvmem_sector_buf[NVMEM_FLASH_ERASE_SIZE];
+#endif
+
+/**
+    @brief    - Copies 'size' bytes from src to dst. Word accesses are used for the
+                part of the range where both addresses are word aligned.
+    @param    - dst     : Destination address
+                src     : Source address
+                size    : Number of bytes
+    @return   - void
+**/
+static void nvmem_copy(uint8_t *dst, const uint8_t *src, int size)
+{
+    if ((((uintptr_t)dst ^ (uintptr_t)src) & NVMEM_WORD_MASK) == 0)
+    {
+        /* Byte copy up to the first word boundary */
+        while ((size > 0) && (((uintptr_t)dst & NVMEM_WORD_MASK) != 0))
+        {
+            *dst++ = *src++;
+            size--;
+        }
+
+        while (size >= (int)sizeof(uint32_t))
+        {
+            *(volatile uint32_t *)dst = *(const volatile uint32_t *)src;
+            dst += sizeof(uint32_t);
+            src += sizeof(uint32_t);
+            size -= sizeof(uint32_t);
+        }
+    }
+
+    while (size > 0)
+    {
+        *dst++ = *src++;
+        size--;
+    }
+}
+
+#ifdef NVMEM_FLASH_ERASE_SIZE
+/**
+    @brief    - Updates part of one flash erase sector. The sector is erased only if
+                the new data clears a bit which is already 0 in flash, and nothing is
+                programmed if the data is unchanged.
+    @param    - sector  : Start address of the erase sector
+                offset  : Offset within the sector
+                buffer  : Pointer to source address
+                size    : Number of bytes, offset + size must not cross the sector
+    @return   - 1/0
+**/
+static int nvmem_flash_update_sector(addr_t sector, uint32_t offset, const uint8_t *buffer, int size)
+{
+    const uint8_t   *flash = (const uint8_t *)sector;
+    int             i, changed = 0, erase = 0;
+
+    for (i = 0; i < size; i++)
+    {
+        if (flash[offset + i] != buffer[i])
+        {
+            changed = 1;
+            /* Programming can only clear bits */
+            if ((flash[offset + i] & buffer[i]) != buffer[i])
+            {
+                erase = 1;
+                break;
+            }
+        }
+    }
+
+    if (!changed)
+    {
+        return 1;
+    }
+
+    if (!erase)
+    {
+        return (pal_nvmem_flash_program(sector + offset, (void *)buffer, size) == 0);
+    }
+
+    nvmem_copy(nvmem_sector_buf, flash, NVMEM_FLASH_ERASE_SIZE);
+    nvmem_copy(nvmem_sector_buf + offset, buffer, size);
+
+    if (pal_nvmem_flash_erase(sector))
+    {
+        return 0;
+    }
+
+    return (pal_nvmem_flash_program(sector, nvmem_sector_buf, NVMEM_FLASH_ERASE_SIZE) == 0);
+}
+#endif
+
 /**
     @brief    - Writes into given non-volatile address.
     @param    - base    : Base address of non-volatile memory
@@ -27,17 +118,43 @@
 **/
 int nvmem_write(addr_t base, uint32_t offset, void *buffer, int size)
 {
-    int b_cnt;
+#ifdef NVMEM_FLASH_ERASE_SIZE
+    addr_t          addr = base + offset;
+    addr_t          sector;
+    uint32_t        sector_offset;
+    int             len;
+    const uint8_t   *src = (const uint8_t *)buffer;
+#endif
 
     if (buffer == NULL) {
         return 0;
     }
 
-    for (b_cnt = 0; b_cnt < size; b_cnt++)
+#ifdef NVMEM_FLASH_ERASE_SIZE
+    /* Flash backed NVMEM, update the range one erase sector at a time */
+    while (size > 0)
     {
-        /* If flash interface just emulated over SRAM, use simple memory write */
-        *(uint8_t *)(base + offset + b_cnt) = *((uint8_t *)buffer + b_cnt);
+        sector = addr & ~((addr_t)NVMEM_FLASH_ERASE_SIZE - 1);
+        sector_offset = addr - sector;
+        len = NVMEM_FLASH_ERASE_SIZE - sector_offset;
+        if (len > size)
+        {
+            len = size;
+        }
+
+        if (!nvmem_flash_update_sector(sector, sector_offset, src, len))
+        {
+            return 0;
+        }
+
+        addr += len;
+        src += len;
+        size -= len;
     }
+#else
+    /* If flash interface just emulated over SRAM, use simple memory write */
+    nvmem_copy((uint8_t *)(base + offset), (const uint8_t *)buffer, size);
+#endif
 
     return 1;
 }
@@ -52,18 +169,12 @@ int nvmem_write(addr_t base, uint32_t offset, void *buffer, int size)
 **/
 int nvmem_read(addr_t base, uint32_t offset, void *buffer, int size)
 {
-    int b_cnt;
-
     if (buffer == NULL) {
         return 0;
     }
 
-    for (b_cnt = 0; b_cnt < size; b_cnt++)
-    {
-        /* If flash interface just emulated over SRAM, use simple memory read */
-        *((uint8_t *)buffer + b_cnt) = *(uint8_t *)(base + offset + b_cnt);
-    }
+    /* SRAM and flash backed NVMEM are both memory mapped for reads */
+    nvmem_copy((uint8_t *)buffer, (const uint8_t *)(base + offset), size);
 
     return 1;
 }
-
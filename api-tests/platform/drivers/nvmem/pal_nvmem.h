@@ -20,7 +20,18 @@
 
 #include "pal_common.h"
 
+#define NVMEM_WORD_MASK     (sizeof(uint32_t) - 1)
+
 int nvmem_write(addr_t base, uint32_t offset, void *buffer, int size);
 int nvmem_read(addr_t base, uint32_t offset, void *buffer, int size);
 
+/* NVMEM_FLASH_ERASE_SIZE is defined by targets whose NVMEM region is flash rather
+ * than SRAM. It must be a power of two. Such targets provide the below primitives,
+ * both of which return 0 on success.
+ */
+#ifdef NVMEM_FLASH_ERASE_SIZE
+int pal_nvmem_flash_erase(addr_t sector_addr);
+int pal_nvmem_flash_program(addr_t addr, void *buffer, int size);
+#endif
+
 #endif /* PAL_NVMEM_H */
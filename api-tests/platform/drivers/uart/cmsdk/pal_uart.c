@@ -19,6 +19,14 @@
 
 volatile uint32_t g_uart;
 
+/* Software TX FIFO of the interrupt driven mode. The print functions are the only
+ * producer and advance tx_head. The bytes are moved to the UART by the TX interrupt
+ * handler, or by the producer while it masks the TX interrupt, which advance tx_tail. */
+static uint8_t           tx_fifo[CMSDK_UART_TX_FIFO_SIZE];
+static volatile uint32_t tx_head;
+static volatile uint32_t tx_tail;
+static uint32_t          tx_irq_mode;
+
 /**
     @brief    - This function initializes the UART
 **/
@@ -45,18 +53,76 @@ static int pal_uart_cmsdk_is_tx_empty(void)
 }
 
 /**
-    @brief    - This function checks for empty TX FIFO and writes to FIFO register
+    @brief    - This function moves the queued bytes to the UART until its TX buffer
+                is full or the FIFO is empty
+    @param    - void
+    @return   - void
 **/
-static void pal_uart_cmsdk_putc(uint8_t c)
+static void pal_uart_cmsdk_tx_drain(void)
 {
+    while ((tx_tail != tx_head) && pal_uart_cmsdk_is_tx_empty())
+    {
+        ((uart_t *) g_uart)->DATA = tx_fifo[tx_tail & (CMSDK_UART_TX_FIFO_SIZE - 1)];
+        tx_tail++;
+    }
+}
+
+/**
+    @brief    - This function starts sending the queued bytes if the UART is idle.
+                The TX interrupt is masked meanwhile, so that the interrupt handler
+                does not move the same bytes. A TX interrupt lost meanwhile only delays
+                the queued bytes until the next print or flush.
+    @param    - void
+    @return   - void
+**/
+static void pal_uart_cmsdk_tx_start(void)
+{
+    if (!tx_irq_mode)
+    {
+        return;
+    }
+
+    ((uart_t *) g_uart)->CTRL &= ~CMSDK_UART_CTRL_TXIRQEN_Msk;
+    pal_uart_cmsdk_tx_drain();
+    ((uart_t *) g_uart)->CTRL |= CMSDK_UART_CTRL_TXIRQEN_Msk;
+}
+
+/**
+    @brief    - This function queues a byte in the TX FIFO in the interrupt driven
+                mode, else writes it to the UART once its TX buffer is empty
+    @param    - c        : Byte to send
+    @return   - void
+**/
+static void pal_uart_cmsdk_tx_byte(uint8_t c)
+{
+    if (tx_irq_mode)
+    {
+        /* FIFO full: send by polling until there is room */
+        while ((tx_head - tx_tail) == CMSDK_UART_TX_FIFO_SIZE)
+        {
+            pal_uart_cmsdk_tx_start();
+        }
+        tx_fifo[tx_head & (CMSDK_UART_TX_FIFO_SIZE - 1)] = c;
+        tx_head++;
+        return;
+    }
+
     /* ensure TX buffer to be empty */
     while (!pal_uart_cmsdk_is_tx_empty());
 
     /* write the data (upper 24 bits are reserved) */
     ((uart_t *) g_uart)->DATA = c;
+}
+
+/**
+    @brief    - This function sends a byte, followed by a carriage return after a newline
+**/
+static void pal_uart_cmsdk_putc(uint8_t c)
+{
+    pal_uart_cmsdk_tx_byte(c);
     if (c == '\n')
     {
-        pal_uart_cmsdk_putc('\r');
+        pal_uart_cmsdk_tx_byte('\r');
     }
 }
 
@@ -120,6 +186,22 @@ void pal_cmsdk_print(char *str, int32_t data)
             pal_uart_cmsdk_putc(*str);
         }
     }
+    pal_uart_cmsdk_tx_start();
+}
+
+/**
+    @brief    - This function writes raw bytes into UART TX FIFO, without any
+                format or newline conversion
+    @param    - data     : Bytes to write
+              - size     : Number of bytes
+**/
+void pal_uart_cmsdk_write(const uint8_t *data, uint32_t size)
+{
+    while (size--)
+    {
+        pal_uart_cmsdk_tx_byte(*data++);
+    }
+    pal_uart_cmsdk_tx_start();
 }
 
 /**
@@ -157,3 +239,47 @@ void pal_uart_cmsdk_disable_irq(void)
     /* Disable TX interrupt */
     ((uart_t *) g_uart)->CTRL &= ~CMSDK_UART_CTRL_TXIRQEN_Msk;
 }
+
+/**
+    @brief    - This function switches the UART to the interrupt driven TX mode.
+                The prints are queued in the TX FIFO and sent from the TX interrupt,
+                pal_uart_cmsdk_tx_irq_handler must be called from its vector.
+    @param    - intr_id  : Interrupt number of the UART TX interrupt
+    @return   - void
+**/
+void pal_uart_cmsdk_tx_irq_init(uint32_t intr_id)
+{
+    tx_head = 0;
+    tx_tail = 0;
+    tx_irq_mode = 1;
+
+    ((uart_t *) g_uart)->INTCLEAR = CMSDK_UART_INTCLEAR_TXIRQ_Msk;
+    ((uart_t *) g_uart)->CTRL |= CMSDK_UART_CTRL_TXIRQEN_Msk;
+    NVIC_ISER(intr_id >> 5) = (1UL << (intr_id & 0x1F));
+}
+
+/**
+    @brief    - This function handles the UART TX interrupt, sending the next queued byte
+    @param    - void
+    @return   - void
+**/
+void pal_uart_cmsdk_tx_irq_handler(void)
+{
+    ((uart_t *) g_uart)->INTCLEAR = CMSDK_UART_INTCLEAR_TXIRQ_Msk;
+    pal_uart_cmsdk_tx_drain();
+}
+
+/**
+    @brief    - This function waits until all the queued bytes are written to the UART
+    @param    - void
+    @return   - void
+**/
+void pal_uart_cmsdk_flush(void)
+{
+    while (tx_tail != tx_head)
+    {
+        pal_uart_cmsdk_tx_start();
+    }
+
+    while (!pal_uart_cmsdk_is_tx_empty());
+}
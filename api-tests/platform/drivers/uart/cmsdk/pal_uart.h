@@ -37,6 +37,14 @@
 #define CMSDK_UART_INTSTATUS_TXIRQ_Msk       (0x01ul << CMSDK_UART_INTSTATUS_TXIRQ_Pos)
                                             /* CMSDK_UART STATUS: TXIRQ Mask */
 
+/* Size of the software TX FIFO used in the interrupt driven mode, a power of 2 */
+#ifndef CMSDK_UART_TX_FIFO_SIZE
+#define CMSDK_UART_TX_FIFO_SIZE        512
+#endif
+
+/* NVIC interrupt set enable registers */
+#define NVIC_ISER(n)                   (*(volatile uint32_t *)(0xE000E100UL + 4 * (n)))
+
 /* typedef's */
 typedef struct {
     uint32_t  DATA;                     /* Offset: 0x000 (R/W) Data Register */
@@ -53,6 +61,10 @@ typedef struct {
 /* function prototypes */
 void pal_uart_cmsdk_init(uint32_t uart_base_addr);
 void pal_cmsdk_print(char *str, int32_t data);
+void pal_uart_cmsdk_write(const uint8_t *data, uint32_t size);
+void pal_uart_cmsdk_tx_irq_init(uint32_t intr_id);
+void pal_uart_cmsdk_tx_irq_handler(void);
+void pal_uart_cmsdk_flush(void);
 void pal_uart_cmsdk_generate_irq(void);
 void pal_uart_cmsdk_disable_irq(void);
 
@@ -19,6 +19,14 @@
 
 volatile uint32_t g_uart;
 
+/* Software TX FIFO of the interrupt driven mode. The print functions are the only
+ * producer and advance tx_head. The bytes are moved to the UART by the TX interrupt
+ * handler, or by the producer while it masks the TX interrupt, which advance tx_tail. */
+static uint8_t           tx_fifo[UART_PL011_TX_FIFO_SIZE];
+static volatile uint32_t tx_head;
+static volatile uint32_t tx_tail;
+static uint32_t          tx_irq_mode;
+
 /**
     @brief    - This function initializes the UART
     @param    - uart_base_addr: Base address of UART
@@ -48,12 +56,59 @@ static int pal_uart_is_tx_empty(void)
 }
 
 /**
-    @brief    - This function checks for empty TX FIFO and writes to FIFO register
+    @brief    - This function moves the queued bytes to the UART until its TX FIFO
+                is full or the software FIFO is empty
+    @param    - void
+    @return   - void
+**/
+static void pal_uart_pl011_tx_drain(void)
+{
+    while ((tx_tail != tx_head) && pal_uart_is_tx_empty())
+    {
+        ((uart_t *)g_uart)->uartdr = tx_fifo[tx_tail & (UART_PL011_TX_FIFO_SIZE - 1)];
+        tx_tail++;
+    }
+}
+
+/**
+    @brief    - This function starts sending the queued bytes if the UART is idle.
+                The TX interrupt is masked meanwhile, so that the interrupt handler
+                does not move the same bytes.
+    @param    - void
+    @return   - void
+**/
+static void pal_uart_pl011_tx_start(void)
+{
+    if (!tx_irq_mode)
+    {
+        return;
+    }
+
+    ((uart_t *)g_uart)->uartimsc &= (uint32_t)(~UART_PL011_TX_INTR_MASK);
+    pal_uart_pl011_tx_drain();
+    ((uart_t *)g_uart)->uartimsc |= (uint32_t)(UART_PL011_TX_INTR_MASK);
+}
+
+/**
+    @brief    - This function queues a byte in the software FIFO in the interrupt
+                driven mode, else writes it to the UART once its TX FIFO has room
 **/
 void pal_uart_putc(uint8_t c)
 {
     const uint8_t pdata = (uint8_t)c;
 
+    if (tx_irq_mode)
+    {
+        /* FIFO full: send by polling until there is room */
+        while ((tx_head - tx_tail) == UART_PL011_TX_FIFO_SIZE)
+        {
+            pal_uart_pl011_tx_start();
+        }
+        tx_fifo[tx_head & (UART_PL011_TX_FIFO_SIZE - 1)] = pdata;
+        tx_head++;
+        return;
+    }
+
     /* ensure TX buffer to be empty */
     while(!pal_uart_is_tx_empty());
 
@@ -127,6 +182,22 @@ void pal_uart_pl011_print(char *str, int32_t data)
             }
         }
     }
+    pal_uart_pl011_tx_start();
+}
+
+/**
+    @brief    - This function writes raw bytes into UART TX FIFO, without any
+                format or newline conversion
+    @param    - data     : Bytes to write
+              - size     : Number of bytes
+**/
+void pal_uart_pl011_write(const uint8_t *data, uint32_t size)
+{
+    while (size--)
+    {
+        pal_uart_putc(*data++);
+    }
+    pal_uart_pl011_tx_start();
 }
 
 /**
@@ -168,3 +239,49 @@ void pal_uart_pl011_disable_irq(void)
     /* Disable TX interrupt */
     ((uart_t *) g_uart)->uartimsc &= (uint32_t)(~UART_PL011_TX_INTR_MASK);
 }
+
+/**
+    @brief    - This function switches the UART to the interrupt driven TX mode.
+                The prints are queued in the software FIFO and sent from the TX
+                interrupt, pal_uart_pl011_tx_irq_handler must be called from its vector.
+    @param    - intr_id  : Interrupt number of the UART TX interrupt
+    @return   - void
+**/
+void pal_uart_pl011_tx_irq_init(uint32_t intr_id)
+{
+    tx_head = 0;
+    tx_tail = 0;
+    tx_irq_mode = 1;
+
+    ((uart_t *) g_uart)->uarticr = (uint32_t)(UART_PL011_TX_INTR_MASK);
+    ((uart_t *) g_uart)->uartimsc |= (uint32_t)(UART_PL011_TX_INTR_MASK);
+    NVIC_ISER(intr_id >> 5) = (1UL << (intr_id & 0x1F));
+}
+
+/**
+    @brief    - This function handles the UART TX interrupt, refilling the TX FIFO
+                of the UART with the queued bytes
+    @param    - void
+    @return   - void
+**/
+void pal_uart_pl011_tx_irq_handler(void)
+{
+    ((uart_t *) g_uart)->uarticr = (uint32_t)(UART_PL011_TX_INTR_MASK);
+    pal_uart_pl011_tx_drain();
+}
+
+/**
+    @brief    - This function waits until all the queued bytes are written to the UART
+    @param    - void
+    @return   - void
+**/
+void pal_uart_pl011_flush(void)
+{
+    while (tx_tail != tx_head)
+    {
+        pal_uart_pl011_tx_start();
+    }
+
+    /* Wait until the TX FIFO of the UART is sent */
+    while (((uart_t *) g_uart)->uartfr & UART_PL011_UARTFR_BUSY);
+}
@@ -20,6 +20,14 @@
 
 #include <stdint.h>
 
+/* Size of the software TX FIFO used in the interrupt driven mode, a power of 2 */
+#ifndef UART_PL011_TX_FIFO_SIZE
+#define UART_PL011_TX_FIFO_SIZE            512
+#endif
+
+/* NVIC interrupt set enable registers */
+#define NVIC_ISER(n)                   (*(volatile uint32_t *)(0xE000E100UL + 4 * (n)))
+
 /* typedef's */
 typedef struct
 {
@@ -47,10 +55,12 @@ typedef struct
 #define UART_PL011_UARTCR_UARTEN_OFF       0x0u
 #define UART_PL011_UARTCR_TXE_OFF          0x8u
 #define UART_PL011_UARTFR_TX_FIFO_FULL_OFF 0x5u
+#define UART_PL011_UARTFR_BUSY_OFF         0x3u
 
 #define UART_PL011_UATRCR_EN_MASK          (0x1u << UART_PL011_UARTCR_UARTEN_OFF)
 #define UART_PL011_UARTCR_TX_EN_MASK       (0x1u << UART_PL011_UARTCR_TXE_OFF)
 #define UART_PL011_UARTFR_TX_FIFO_FULL     (0x1u << UART_PL011_UARTFR_TX_FIFO_FULL_OFF)
+#define UART_PL011_UARTFR_BUSY             (0x1u << UART_PL011_UARTFR_BUSY_OFF)
 
 #define UART_PL011_INTR_TX_OFF             0x5u
 #define UART_PL011_TX_INTR_MASK            (0x1u << UART_PL011_INTR_TX_OFF)
@@ -60,6 +70,10 @@ typedef struct
 /* function prototypes */
 void pal_uart_pl011_init(uint32_t uart_base_addr);
 void pal_uart_pl011_print(char *str, int32_t data);
+void pal_uart_pl011_write(const uint8_t *data, uint32_t size);
+void pal_uart_pl011_tx_irq_init(uint32_t intr_id);
+void pal_uart_pl011_tx_irq_handler(void);
+void pal_uart_pl011_flush(void);
 void pal_uart_pl011_generate_irq(void);
 void pal_uart_pl011_disable_irq(void);
 
@@ -0,0 +1,585 @@
+/** @file
+ * Copyright (c) 2018-2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stdio.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "pal_common.h"
+#include "pal_nvmem.h"
+#include "pal_host.h"
+
+static uint8_t      *host_nvmem;
+static uint8_t      host_nvmem_reset[PAL_HOST_NVMEM_SIZE];
+static uint32_t     host_resets;
+static uint32_t     host_wd_time_us;
+static uint32_t     host_tests[PAL_HOST_MAX_TESTS];
+static uint32_t     host_num_tests;
+static int          host_keep_nvmem;
+
+/**
+    @brief    - Emulates a system reset. The test process exits and the supervisor
+                process starts a new one. NVMEM contents are kept as the mapping is
+                shared with the supervisor.
+    @param    - void
+    @return   - void
+**/
+void pal_host_reset(void)
+{
+    fflush(stdout);
+    _exit(PAL_HOST_EXIT_RESET);
+}
+
+/**
+    @brief    - SIGALRM handler, the watchdog timer expired
+    @param    - sig      : Signal number
+    @return   - void
+**/
+static void pal_host_wd_expired(int sig)
+{
+    (void)sig;
+    _exit(PAL_HOST_EXIT_RESET);
+}
+
+/**
+    @brief    - Checks whether a signal is raised by a fault of the process itself,
+                as on a panic of the PSA implementation
+    @param    - sig      : Signal number
+    @return   - 1 for a fault, 0 otherwise
+**/
+static int pal_host_is_panic(int sig)
+{
+    return ((sig == SIGSEGV) || (sig == SIGBUS) || (sig == SIGILL) || (sig == SIGFPE)
+            || (sig == SIGABRT) || (sig == SIGTRAP));
+}
+
+/**
+    @brief    - Runs the tests in a child process of the supervisor process, and starts
+                a new child at once on each emulated system reset. A child killed by a
+                fault, as on a panic, is restarted in the same way. The new child is
+                forked from the supervisor, so it starts from the state of the process
+                before val_entry, with the NVMEM left by the previous child.
+    @param    - void
+    @return   - SUCCESS in the child. The supervisor exits with the status of the last
+                child, or returns FAILURE if a child cannot be started.
+**/
+static int pal_host_supervise(void)
+{
+    pid_t       pid;
+    int         wstatus;
+
+    while (1)
+    {
+        fflush(stdout);
+        pid = fork();
+        if (pid == 0)
+        {
+            /* The test process must not outlive a supervisor killed on a timeout */
+            prctl(PR_SET_PDEATHSIG, SIGKILL);
+            return PAL_STATUS_SUCCESS;
+        }
+
+        if ((pid < 0) || (waitpid(pid, &wstatus, 0) != pid))
+        {
+            perror("fork");
+            return PAL_STATUS_ERROR;
+        }
+
+        if (WIFEXITED(wstatus) && (WEXITSTATUS(wstatus) != PAL_HOST_EXIT_RESET))
+        {
+            exit(WEXITSTATUS(wstatus));
+        }
+
+        if (WIFSIGNALED(wstatus))
+        {
+            if (!pal_host_is_panic(WTERMSIG(wstatus)))
+            {
+                exit(128 + WTERMSIG(wstatus));
+            }
+            fprintf(stderr, "Test process killed by signal %d, resetting\n", WTERMSIG(wstatus));
+        }
+
+        /* A reset which finds NVMEM as the previous one did would repeat forever */
+        if (host_resets && !memcmp(host_nvmem_reset, host_nvmem, PAL_HOST_NVMEM_SIZE))
+        {
+            fprintf(stderr, "No progress since the previous reset, stopping\n");
+            exit(1);
+        }
+        memcpy(host_nvmem_reset, host_nvmem, PAL_HOST_NVMEM_SIZE);
+        host_resets++;
+    }
+}
+
+/**
+    @brief    - Parses the command line of the host executable
+    @param    - argc     : Number of command line arguments
+              - argv     : Command line arguments
+    @return   - SUCCESS/FAILURE
+**/
+static int pal_host_parse_args(int argc, char *argv[])
+{
+    char        *str, *end;
+    int         i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], PAL_HOST_ARG_KEEP_NVMEM) == 0)
+        {
+            host_keep_nvmem = 1;
+            continue;
+        }
+
+        if ((strcmp(argv[i], PAL_HOST_ARG_TESTS) != 0) || (i + 1 >= argc))
+        {
+            fprintf(stderr, "usage: %s [%s <id>,<id>,...] [%s]\n", argv[0], PAL_HOST_ARG_TESTS,
+                    PAL_HOST_ARG_KEEP_NVMEM);
+            return PAL_STATUS_ERROR;
+        }
+
+        for (str = argv[++i]; *str != '\0'; str = end)
+        {
+            if (host_num_tests >= PAL_HOST_MAX_TESTS)
+            {
+                fprintf(stderr, "%s: too many test IDs\n", PAL_HOST_ARG_TESTS);
+                return PAL_STATUS_ERROR;
+            }
+
+            host_tests[host_num_tests++] = strtoul(str, &end, 10);
+            if ((end == str) || ((*end != ',') && (*end != '\0')))
+            {
+                fprintf(stderr, "%s: invalid test ID list\n", PAL_HOST_ARG_TESTS);
+                return PAL_STATUS_ERROR;
+            }
+
+            if (*end == ',')
+            {
+                ++end;
+            }
+        }
+    }
+
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Sets up the emulated peripherals of the host target and starts the
+                test process. The NVMEM file is cleared unless the executable is
+                started with --keep-nvmem to keep the test selection and results of
+                the previous run.
+    @param    - argc     : Number of command line arguments
+              - argv     : Command line arguments
+    @return   - SUCCESS/FAILURE. Returns only in the test process.
+**/
+int pal_host_init(int argc, char *argv[])
+{
+    struct sigaction    action;
+    struct itimerval    timer;
+    sigset_t            mask;
+    const char          *path;
+    int                 fd;
+
+    if (pal_host_parse_args(argc, argv) != PAL_STATUS_SUCCESS)
+    {
+        return PAL_STATUS_ERROR;
+    }
+
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_REAL, &timer, NULL);
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGALRM);
+    sigprocmask(SIG_UNBLOCK, &mask, NULL);
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = pal_host_wd_expired;
+    action.sa_flags = SA_NODEFER;
+    sigaction(SIGALRM, &action, NULL);
+
+    /* Only complete lines are lost when the watchdog ends the test process */
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    path = getenv(PAL_HOST_ENV_NVMEM);
+    if (path == NULL)
+    {
+        path = PAL_HOST_NVMEM_FILE;
+    }
+
+    fd = open(path, O_RDWR | O_CREAT | (host_keep_nvmem ? 0 : O_TRUNC), 0644);
+    if (fd < 0)
+    {
+        perror(path);
+        return PAL_STATUS_ERROR;
+    }
+
+    if (ftruncate(fd, PAL_HOST_NVMEM_SIZE))
+    {
+        perror(path);
+        close(fd);
+        return PAL_STATUS_ERROR;
+    }
+
+    host_nvmem = mmap(NULL, PAL_HOST_NVMEM_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (host_nvmem == MAP_FAILED)
+    {
+        perror(path);
+        host_nvmem = NULL;
+        return PAL_STATUS_ERROR;
+    }
+
+    return pal_host_supervise();
+}
+
+/**
+    @brief    - This function initializes the UART
+    @param    - uart base addr
+    @return   - SUCCESS/FAILURE
+**/
+int pal_uart_init_ns(uint32_t uart_base_addr)
+{
+    (void)uart_base_addr;
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - This function parses the input string and writes it to stdout
+    @param    - str      : Input String
+              - data     : Value for format specifier
+    @return   - SUCCESS/FAILURE
+**/
+
+int pal_print_ns(char *str, int32_t data)
+{
+    for (; *str != '\0'; ++str)
+    {
+        if (*str != '%')
+        {
+            putchar(*str);
+            continue;
+        }
+
+        ++str;
+        if (*str == 'd')
+        {
+            printf("%d", (int)data);
+        }
+        else if (*str == 'x' || *str == 'X')
+        {
+            printf("%X", (unsigned int)data);
+        }
+        else if (*str == '\0')
+        {
+            break;
+        }
+    }
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Writes out the data buffered by stdout
+    @param    - void
+    @return   - SUCCESS/FAILURE
+**/
+int pal_print_flush_ns(void)
+{
+    fflush(stdout);
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Writes raw bytes to stdout, used by the binary log mode
+    @param    - data     : Bytes to write
+              - size     : Number of bytes
+    @return   - SUCCESS/FAILURE
+**/
+int pal_uart_write_ns(uint8_t *data, uint32_t size)
+{
+    if (fwrite(data, 1, size, stdout) != size)
+    {
+        return PAL_STATUS_ERROR;
+    }
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Switches the UART to the interrupt driven TX mode. Not supported,
+                stdout is written directly.
+    @param    - intr_id  : Interrupt number of the UART TX interrupt
+    @return   - PAL_STATUS_UNSUPPORTED_FUNC
+**/
+int pal_uart_tx_irq_init_ns(uint32_t intr_id)
+{
+    (void)intr_id;
+    return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+/**
+    @brief    - UART TX interrupt handler of the interrupt driven TX mode
+    @param    - void
+    @return   - void
+**/
+void pal_uart_tx_irq_handler_ns(void)
+{
+}
+
+/**
+    @brief           - Initializes the watchdog timer, emulated by ITIMER_REAL
+    @param           - base_addr       : Base address of the watchdog module
+                     - time_us         : Time in micro seconds
+                     - timer_tick_us   : Number of ticks per micro second
+    @return          - SUCCESS/FAILURE
+**/
+int pal_wd_timer_init_ns(addr_t base_addr, uint32_t time_us, uint32_t timer_tick_us)
+{
+    (void)base_addr;
+    (void)timer_tick_us;
+    host_wd_time_us = time_us;
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief           - Enables the watchdog timer. SIGALRM is raised on expiry.
+    @param           - base_addr       : Base address of the watchdog module
+    @return          - SUCCESS/FAILURE
+**/
+int pal_wd_timer_enable_ns(addr_t base_addr)
+{
+    struct itimerval    timer;
+
+    (void)base_addr;
+    memset(&timer, 0, sizeof(timer));
+    timer.it_value.tv_sec = host_wd_time_us / 1000000;
+    timer.it_value.tv_usec = host_wd_time_us % 1000000;
+
+    if (setitimer(ITIMER_REAL, &timer, NULL))
+    {
+        return PAL_STATUS_ERROR;
+    }
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief           - Disables the watchdog timer
+    @param           - base_addr  : Base address of the watchdog module
+    @return          - SUCCESS/FAILURE
+**/
+int pal_wd_timer_disable_ns(addr_t base_addr)
+{
+    struct itimerval    timer;
+
+    (void)base_addr;
+    memset(&timer, 0, sizeof(timer));
+
+    if (setitimer(ITIMER_REAL, &timer, NULL))
+    {
+        return PAL_STATUS_ERROR;
+    }
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Reads from given non-volatile address. The address is an offset
+                into the NVMEM file.
+    @param    - base    : Base address of nvmem
+                offset  : Offset
+                buffer  : Pointer to source address
+                size    : Number of bytes
+    @return   - SUCCESS/FAILURE
+**/
+int pal_nvmem_read_ns(addr_t base, uint32_t offset, void *buffer, int size)
+{
+    if ((host_nvmem == NULL) || (size < 0) || ((base + offset + size) > PAL_HOST_NVMEM_SIZE))
+    {
+        return PAL_STATUS_ERROR;
+    }
+
+    if (nvmem_read((addr_t)host_nvmem, base + offset, buffer, size))
+    {
+        return PAL_STATUS_SUCCESS;
+    }
+    else
+    {
+        return PAL_STATUS_ERROR;
+    }
+}
+
+/**
+    @brief    - Writes into given non-volatile address. The address is an offset
+                into the NVMEM file.
+    @param    - base    : Base address of nvmem
+                offset  : Offset
+                buffer  : Pointer to source address
+                size    : Number of bytes
+    @return   - SUCCESS/FAILURE
+**/
+int pal_nvmem_write_ns(addr_t base, uint32_t offset, void *buffer, int size)
+{
+    if ((host_nvmem == NULL) || (size < 0) || ((base + offset + size) > PAL_HOST_NVMEM_SIZE))
+    {
+        return PAL_STATUS_ERROR;
+    }
+
+    if (nvmem_write((addr_t)host_nvmem, base + offset, buffer, size))
+    {
+        return PAL_STATUS_SUCCESS;
+    }
+    else
+    {
+        return PAL_STATUS_ERROR;
+    }
+}
+
+/**
+ *   @brief    - This function will read peripherals using SPI commands
+ *   @param    - addr : address of the peripheral
+ *               data : read buffer
+ *               len  : length of the read buffer in bytes
+ *   @return   - error status
+**/
+int pal_spi_read(addr_t addr, uint8_t *data, uint32_t len)
+{
+    return 0xFF;
+}
+
+/**
+ *   @brief    - Enables the cycle counter. The host has no portable cycle counter,
+ *               the monotonic clock in PAL_HOST_COUNTER_NS units stands in for it. The
+ *               counter then wraps after 42.9 s, longer than any watchdog timeout of
+ *               the target, so that the watchdog windows can be measured.
+ *   @param    - freq_hz : Returns the counter frequency in Hz
+ *   @return   - SUCCESS/FAILURE
+**/
+int pal_cycle_counter_init_ns(uint32_t *freq_hz)
+{
+    struct timespec     now;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &now))
+    {
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+    }
+
+    *freq_hz = 1000000000 / PAL_HOST_COUNTER_NS;
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+ *   @brief    - Reads the cycle counter
+ *   @param    - void
+ *   @return   - Counter value, wraps around at 32 bits
+**/
+uint32_t pal_cycle_counter_read_ns(void)
+{
+    struct timespec     now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(((uint64_t)now.tv_sec * 1000000000 + now.tv_nsec) / PAL_HOST_COUNTER_NS);
+}
+
+/**
+ *   @brief    - Checks whether the given test is selected to run. All the tests of
+ *               the suite are run unless a list was given with --tests.
+ *   @param    - test_id : Test ID
+ *   @return   - 1 if the test must run, 0 otherwise
+**/
+int pal_test_select_ns(uint32_t test_id)
+{
+    uint32_t    i;
+
+    if (host_num_tests == 0)
+    {
+        return 1;
+    }
+
+    for (i = 0; i < host_num_tests; i++)
+    {
+        if (host_tests[i] == test_id)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Thread of pal_thread_run_ns, pthreads take a function returning a pointer */
+typedef struct {
+    void        (*fn)(void *arg);
+    void        *arg;
+} host_thread_t;
+
+static void *host_thread_entry(void *arg)
+{
+    host_thread_t   *thread = (host_thread_t *)arg;
+
+    thread->fn(thread->arg);
+    return NULL;
+}
+
+/**
+ *   @brief    - Runs a function on several threads at once and waits for all of them to end
+ *   @param    - fn    : Function run by each thread
+ *               args  : Argument of each thread
+ *               count : Number of threads
+ *   @return   - SUCCESS/FAILURE
+**/
+int pal_thread_run_ns(void (*fn)(void *arg), void **args, uint32_t count)
+{
+    pthread_t       ids[PAL_HOST_MAX_THREADS];
+    host_thread_t   threads[PAL_HOST_MAX_THREADS];
+    uint32_t        i, started;
+    int             status = PAL_STATUS_SUCCESS;
+
+    if (count > PAL_HOST_MAX_THREADS)
+    {
+        return PAL_STATUS_ERROR;
+    }
+
+    for (started = 0; started < count; started++)
+    {
+        threads[started].fn = fn;
+        threads[started].arg = args[started];
+        if (pthread_create(&ids[started], NULL, host_thread_entry, &threads[started]))
+        {
+            status = PAL_STATUS_ERROR;
+            break;
+        }
+    }
+
+    for (i = 0; i < started; i++)
+    {
+        pthread_join(ids[i], NULL);
+    }
+    return status;
+}
+
+/**
+ *   @brief    - Terminates the simulation at the end of all tests completion.
+ *               The host process exits.
+ *   @param    - void
+ *   @return   - void
+**/
+void pal_terminate_simulation(void)
+{
+    pal_wd_timer_disable_ns(0);
+    fflush(stdout);
+    exit(0);
+}
@@ -0,0 +1,46 @@
+/** @file
+ * Copyright (c) 2018-2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _PAL_HOST_H_
+#define _PAL_HOST_H_
+
+#include "pal_common.h"
+
+/* File backing the NVMEM region, can be overridden with the environment variable */
+#define PAL_HOST_ENV_NVMEM          "PSA_HOST_NVMEM"
+#define PAL_HOST_NVMEM_FILE         "psa_nvmem.bin"
+#define PAL_HOST_NVMEM_SIZE         0x400
+
+/* Exit status of a test process which requests an emulated system reset */
+#define PAL_HOST_EXIT_RESET         0xA5
+
+/* "--tests <id>,<id>,..." restricts the run to the listed test IDs */
+#define PAL_HOST_ARG_TESTS          "--tests"
+#define PAL_HOST_MAX_TESTS          200
+
+/* "--keep-nvmem" keeps the NVMEM file of the previous run, with its test selection and results */
+#define PAL_HOST_ARG_KEEP_NVMEM     "--keep-nvmem"
+
+/* Largest number of threads of pal_thread_run_ns */
+#define PAL_HOST_MAX_THREADS        8
+
+/* Nanoseconds per tick of the cycle counter, which runs at 100 MHz */
+#define PAL_HOST_COUNTER_NS         10
+
+int pal_host_init(int argc, char *argv[]);
+void pal_host_reset(void);
+#endif /* _PAL_HOST_H_ */
@@ -0,0 +1,37 @@
+/** @file
+ * Copyright (c) 2018-2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_entry.h"
+#include "pal_host.h"
+
+/**
+    @brief    - Entry point of the host executable. Sets up the emulated peripherals
+                and hands over to the VAL.
+    @param    - argc     : Number of command line arguments
+              - argv     : Command line arguments
+    @return   - Process exit status
+**/
+int main(int argc, char *argv[])
+{
+    if (pal_host_init(argc, argv) != PAL_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+
+    val_entry();
+    return 0;
+}
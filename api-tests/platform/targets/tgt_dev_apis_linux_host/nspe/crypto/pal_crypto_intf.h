@@ -0,0 +1,275 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _PAL_CRYPTO_H_
+#define _PAL_CRYPTO_H_
+
+#include "pal_common.h"
+
+enum pal_crypto_function_code {
+    PAL_CRYPTO_INIT                             = 0x1,
+    PAL_CRYPTO_GENERATE_RANDOM                  = 0x2,
+    PAL_CRYPTO_IMPORT_KEY                       = 0x3,
+    PAL_CRYPTO_EXPORT_KEY                       = 0x4,
+    PAL_CRYPTO_EXPORT_PUBLIC_KEY                = 0x5,
+    PAL_CRYPTO_DESTROY_KEY                      = 0x6,
+    PAL_CRYPTO_HASH_SETUP                       = 0x7,
+    PAL_CRYPTO_HASH_UPDATE                      = 0x8,
+    PAL_CRYPTO_HASH_VERIFY                      = 0x9,
+    PAL_CRYPTO_HASH_FINISH                      = 0xA,
+    PAL_CRYPTO_HASH_ABORT                       = 0xB,
+    PAL_CRYPTO_GENERATE_KEY                     = 0xC,
+    PAL_CRYPTO_AEAD_ENCRYPT                     = 0xD,
+    PAL_CRYPTO_AEAD_DECRYPT                     = 0xE,
+    PAL_CRYPTO_MAC_SIGN_SETUP                   = 0xF,
+    PAL_CRYPTO_MAC_UPDATE                       = 0x10,
+    PAL_CRYPTO_MAC_SIGN_FINISH                  = 0x11,
+    PAL_CRYPTO_MAC_VERIFY_SETUP                 = 0x12,
+    PAL_CRYPTO_MAC_VERIFY_FINISH                = 0x13,
+    PAL_CRYPTO_MAC_ABORT                        = 0x14,
+    PAL_CRYPTO_ASYMMTERIC_ENCRYPT               = 0x15,
+    PAL_CRYPTO_ASYMMTERIC_DECRYPT               = 0x16,
+    PAL_CRYPTO_CIPHER_ENCRYPT_SETUP             = 0x17,
+    PAL_CRYPTO_CIPHER_DECRYPT_SETUP             = 0x18,
+    PAL_CRYPTO_CIPHER_GENERATE_IV               = 0x19,
+    PAL_CRYPTO_CIPHER_SET_IV                    = 0x1A,
+    PAL_CRYPTO_CIPHER_UPDATE                    = 0x1B,
+    PAL_CRYPTO_CIPHER_FINISH                    = 0x1C,
+    PAL_CRYPTO_CIPHER_ABORT                     = 0x1D,
+    PAL_CRYPTO_ASYMMTERIC_SIGN                  = 0x1E,
+    PAL_CRYPTO_ASYMMTERIC_VERIFY                = 0x1F,
+    PAL_CRYPTO_COPY_KEY                         = 0x20,
+    PAL_CRYPTO_SET_KEY_TYPE                     = 0x21,
+    PAL_CRYPTO_SET_KEY_BITS                     = 0x22,
+    PAL_CRYPTO_GET_KEY_ATTRIBUTES               = 0x23,
+    PAL_CRYPTO_GET_KEY_TYPE                     = 0x24,
+    PAL_CRYPTO_SET_KEY_USAGE_FLAGS              = 0x25,
+    PAL_CRYPTO_RESET_KEY_ATTRIBUTES             = 0x26,
+    PAL_CRYPTO_SET_KEY_ID                       = 0x27,
+    PAL_CRYPTO_SET_KEY_LIFETIME                 = 0x28,
+    PAL_CRYPTO_SET_KEY_ALGORITHM                = 0x29,
+    PAL_CRYPTO_GET_KEY_ID                       = 0x2A,
+    PAL_CRYPTO_GET_KEY_LIFETIME                 = 0x2B,
+    PAL_CRYPTO_GET_KEY_USAGE_FLAGS              = 0x2C,
+    PAL_CRYPTO_GET_KEY_ALGORITHM                = 0x2D,
+    PAL_CRYPTO_GET_KEY_BITS                     = 0x2E,
+    PAL_CRYPTO_HASH_COMPUTE                     = 0x2F,
+    PAL_CRYPTO_HASH_COMPARE                     = 0x30,
+    PAL_CRYPTO_KEY_DERIVATION_SETUP             = 0x31,
+    PAL_CRYPTO_KEY_DERIVATION_ABORT             = 0x32,
+    PAL_CRYPTO_RAW_KEY_AGREEMENT                = 0x33,
+    PAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES       = 0x34,
+    PAL_CRYPTO_KEY_DERIVATION_INPUT_KEY         = 0x35,
+    PAL_CRYPTO_KEY_DERIVATION_KEY_AGREEMENT     = 0x36,
+    PAL_CRYPTO_KEY_DERIVATION_OUTPUT_BYTES      = 0x37,
+    PAL_CRYPTO_KEY_DERIVATION_OUTPUT_KEY        = 0x38,
+    PAL_CRYPTO_KEY_DERIVATION_SET_CAPACITY      = 0x39,
+    PAL_CRYPTO_KEY_DERIVATION_GET_CAPACITY      = 0x3A,
+    PAL_CRYPTO_HASH_CLONE                       = 0x3B,
+    PAL_CRYPTO_MAC_COMPUTE                      = 0x3C,
+    PAL_CRYPTO_MAC_VERIFY                       = 0x3D,
+    PAL_CRYPTO_CIPHER_ENCRYPT                   = 0x3F,
+    PAL_CRYPTO_CIPHER_DECRYPT                   = 0x40,
+    PAL_CRYPTO_OPEN_KEY                         = 0x41,
+    PAL_CRYPTO_CLOSE_KEY                        = 0x42,
+    PAL_CRYPTO_AEAD_ENCRYPT_SETUP               = 0x43,
+    PAL_CRYPTO_AEAD_DECRYPT_SETUP               = 0x44,
+    PAL_CRYPTO_AEAD_GENERATE_NONCE              = 0x45,
+    PAL_CRYPTO_AEAD_SET_NONCE                   = 0x46,
+    PAL_CRYPTO_AEAD_SET_LENGTHS                 = 0X47,
+    PAL_CRYPTO_AEAD_UPDATE_AD                   = 0x48,
+    PAL_CRYPTO_AEAD_UPDATE                      = 0x49,
+    PAL_CRYPTO_AEAD_FINISH                      = 0x4A,
+    PAL_CRYPTO_AEAD_VERIFY                      = 0x4B,
+    PAL_CRYPTO_AEAD_ABORT                       = 0x4C,
+    PAL_CRYPTO_RESET                            = 0xFD,
+    PAL_CRYPTO_FREE                             = 0xFE,
+};
+
+typedef struct pal_crypto_ops_s pal_crypto_ops_t;
+
+#ifdef CRYPTO
+/* Entry points of the PSA Crypto implementation. Each member takes the arguments of
+ * the psa_* function of the same name, so that callers skip the va_list decoding of
+ * pal_crypto_function. The key attribute accessors may be implemented as macros or
+ * inline functions and are only available through pal_crypto_function.
+ */
+struct pal_crypto_ops_s {
+    psa_status_t (*crypto_init)(void);
+    psa_status_t (*generate_random)(uint8_t *output, size_t output_size);
+    psa_status_t (*import_key)(const psa_key_attributes_t *attributes, const uint8_t *data,
+                               size_t data_length, psa_key_handle_t *handle);
+    psa_status_t (*generate_key)(const psa_key_attributes_t *attributes,
+                                 psa_key_handle_t *handle);
+    psa_status_t (*copy_key)(psa_key_handle_t source_handle,
+                             const psa_key_attributes_t *attributes,
+                             psa_key_handle_t *target_handle);
+    psa_status_t (*export_key)(psa_key_handle_t handle, uint8_t *data, size_t data_size,
+                               size_t *data_length);
+    psa_status_t (*export_public_key)(psa_key_handle_t handle, uint8_t *data,
+                                      size_t data_size, size_t *data_length);
+    psa_status_t (*get_key_attributes)(psa_key_handle_t handle,
+                                       psa_key_attributes_t *attributes);
+    psa_status_t (*open_key)(psa_key_id_t id, psa_key_handle_t *handle);
+    psa_status_t (*close_key)(psa_key_handle_t handle);
+    psa_status_t (*destroy_key)(psa_key_handle_t handle);
+
+    psa_status_t (*hash_compute)(psa_algorithm_t alg, const uint8_t *input,
+                                 size_t input_length, uint8_t *hash, size_t hash_size,
+                                 size_t *hash_length);
+    psa_status_t (*hash_compare)(psa_algorithm_t alg, const uint8_t *input,
+                                 size_t input_length, const uint8_t *hash,
+                                 size_t hash_length);
+    psa_status_t (*hash_setup)(psa_hash_operation_t *operation, psa_algorithm_t alg);
+    psa_status_t (*hash_update)(psa_hash_operation_t *operation, const uint8_t *input,
+                                size_t input_length);
+    psa_status_t (*hash_finish)(psa_hash_operation_t *operation, uint8_t *hash,
+                                size_t hash_size, size_t *hash_length);
+    psa_status_t (*hash_verify)(psa_hash_operation_t *operation, const uint8_t *hash,
+                                size_t hash_length);
+    psa_status_t (*hash_abort)(psa_hash_operation_t *operation);
+    psa_status_t (*hash_clone)(const psa_hash_operation_t *source_operation,
+                               psa_hash_operation_t *target_operation);
+
+    psa_status_t (*mac_compute)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                const uint8_t *input, size_t input_length, uint8_t *mac,
+                                size_t mac_size, size_t *mac_length);
+    psa_status_t (*mac_verify)(psa_key_handle_t handle, psa_algorithm_t alg,
+                               const uint8_t *input, size_t input_length, const uint8_t *mac,
+                               size_t mac_length);
+    psa_status_t (*mac_sign_setup)(psa_mac_operation_t *operation, psa_key_handle_t handle,
+                                   psa_algorithm_t alg);
+    psa_status_t (*mac_verify_setup)(psa_mac_operation_t *operation, psa_key_handle_t handle,
+                                     psa_algorithm_t alg);
+    psa_status_t (*mac_update)(psa_mac_operation_t *operation, const uint8_t *input,
+                               size_t input_length);
+    psa_status_t (*mac_sign_finish)(psa_mac_operation_t *operation, uint8_t *mac,
+                                    size_t mac_size, size_t *mac_length);
+    psa_status_t (*mac_verify_finish)(psa_mac_operation_t *operation, const uint8_t *mac,
+                                      size_t mac_length);
+    psa_status_t (*mac_abort)(psa_mac_operation_t *operation);
+
+    psa_status_t (*cipher_encrypt)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                   const uint8_t *input, size_t input_length,
+                                   uint8_t *output, size_t output_size,
+                                   size_t *output_length);
+    psa_status_t (*cipher_decrypt)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                   const uint8_t *input, size_t input_length,
+                                   uint8_t *output, size_t output_size,
+                                   size_t *output_length);
+    psa_status_t (*cipher_encrypt_setup)(psa_cipher_operation_t *operation,
+                                         psa_key_handle_t handle, psa_algorithm_t alg);
+    psa_status_t (*cipher_decrypt_setup)(psa_cipher_operation_t *operation,
+                                         psa_key_handle_t handle, psa_algorithm_t alg);
+    psa_status_t (*cipher_generate_iv)(psa_cipher_operation_t *operation, uint8_t *iv,
+                                       size_t iv_size, size_t *iv_length);
+    psa_status_t (*cipher_set_iv)(psa_cipher_operation_t *operation, const uint8_t *iv,
+                                  size_t iv_length);
+    psa_status_t (*cipher_update)(psa_cipher_operation_t *operation, const uint8_t *input,
+                                  size_t input_length, uint8_t *output, size_t output_size,
+                                  size_t *output_length);
+    psa_status_t (*cipher_finish)(psa_cipher_operation_t *operation, uint8_t *output,
+                                  size_t output_size, size_t *output_length);
+    psa_status_t (*cipher_abort)(psa_cipher_operation_t *operation);
+
+    psa_status_t (*aead_encrypt)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                 const uint8_t *nonce, size_t nonce_length,
+                                 const uint8_t *additional_data,
+                                 size_t additional_data_length, const uint8_t *plaintext,
+                                 size_t plaintext_length, uint8_t *ciphertext,
+                                 size_t ciphertext_size, size_t *ciphertext_length);
+    psa_status_t (*aead_decrypt)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                 const uint8_t *nonce, size_t nonce_length,
+                                 const uint8_t *additional_data,
+                                 size_t additional_data_length, const uint8_t *ciphertext,
+                                 size_t ciphertext_length, uint8_t *plaintext,
+                                 size_t plaintext_size, size_t *plaintext_length);
+    psa_status_t (*aead_encrypt_setup)(psa_aead_operation_t *operation,
+                                       psa_key_handle_t handle, psa_algorithm_t alg);
+    psa_status_t (*aead_decrypt_setup)(psa_aead_operation_t *operation,
+                                       psa_key_handle_t handle, psa_algorithm_t alg);
+    psa_status_t (*aead_generate_nonce)(psa_aead_operation_t *operation, uint8_t *nonce,
+                                        size_t nonce_size, size_t *nonce_length);
+    psa_status_t (*aead_set_nonce)(psa_aead_operation_t *operation, const uint8_t *nonce,
+                                   size_t nonce_length);
+    psa_status_t (*aead_set_lengths)(psa_aead_operation_t *operation, size_t ad_length,
+                                     size_t plaintext_length);
+    psa_status_t (*aead_update_ad)(psa_aead_operation_t *operation, const uint8_t *input,
+                                   size_t input_length);
+    psa_status_t (*aead_update)(psa_aead_operation_t *operation, const uint8_t *input,
+                                size_t input_length, uint8_t *output, size_t output_size,
+                                size_t *output_length);
+    psa_status_t (*aead_finish)(psa_aead_operation_t *operation, uint8_t *ciphertext,
+                                size_t ciphertext_size, size_t *ciphertext_length,
+                                uint8_t *tag, size_t tag_size, size_t *tag_length);
+    psa_status_t (*aead_verify)(psa_aead_operation_t *operation, uint8_t *plaintext,
+                                size_t plaintext_size, size_t *plaintext_length,
+                                const uint8_t *tag, size_t tag_length);
+    psa_status_t (*aead_abort)(psa_aead_operation_t *operation);
+
+    psa_status_t (*asymmetric_sign)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                    const uint8_t *hash, size_t hash_length,
+                                    uint8_t *signature, size_t signature_size,
+                                    size_t *signature_length);
+    psa_status_t (*asymmetric_verify)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                      const uint8_t *hash, size_t hash_length,
+                                      const uint8_t *signature, size_t signature_length);
+    psa_status_t (*asymmetric_encrypt)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                       const uint8_t *input, size_t input_length,
+                                       const uint8_t *salt, size_t salt_length,
+                                       uint8_t *output, size_t output_size,
+                                       size_t *output_length);
+    psa_status_t (*asymmetric_decrypt)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                       const uint8_t *input, size_t input_length,
+                                       const uint8_t *salt, size_t salt_length,
+                                       uint8_t *output, size_t output_size,
+                                       size_t *output_length);
+
+    psa_status_t (*key_derivation_setup)(psa_key_derivation_operation_t *operation,
+                                         psa_algorithm_t alg);
+    psa_status_t (*key_derivation_input_bytes)(psa_key_derivation_operation_t *operation,
+                                               psa_key_derivation_step_t step,
+                                               const uint8_t *data, size_t data_length);
+    psa_status_t (*key_derivation_input_key)(psa_key_derivation_operation_t *operation,
+                                             psa_key_derivation_step_t step,
+                                             psa_key_handle_t handle);
+    psa_status_t (*key_derivation_key_agreement)(psa_key_derivation_operation_t *operation,
+                                                 psa_key_derivation_step_t step,
+                                                 psa_key_handle_t private_key,
+                                                 const uint8_t *peer_key,
+                                                 size_t peer_key_length);
+    psa_status_t (*key_derivation_set_capacity)(psa_key_derivation_operation_t *operation,
+                                                size_t capacity);
+    psa_status_t (*key_derivation_get_capacity)(
+                                          const psa_key_derivation_operation_t *operation,
+                                          size_t *capacity);
+    psa_status_t (*key_derivation_output_bytes)(psa_key_derivation_operation_t *operation,
+                                                uint8_t *output, size_t output_length);
+    psa_status_t (*key_derivation_output_key)(const psa_key_attributes_t *attributes,
+                                              psa_key_derivation_operation_t *operation,
+                                              psa_key_handle_t *handle);
+    psa_status_t (*key_derivation_abort)(psa_key_derivation_operation_t *operation);
+    psa_status_t (*raw_key_agreement)(psa_algorithm_t alg, psa_key_handle_t private_key,
+                                      const uint8_t *peer_key, size_t peer_key_length,
+                                      uint8_t *output, size_t output_size,
+                                      size_t *output_length);
+};
+#endif
+
+int32_t pal_crypto_function(int type, va_list valist);
+const pal_crypto_ops_t *pal_crypto_get_ops(void);
+#endif /* _PAL_CRYPTO_H_ */
@@ -0,0 +1,1282 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "pal_attestation_crypto.h"
+
+static int pal_encode_cose_key(struct q_useful_buf_c *cose_key,
+                               struct q_useful_buf buffer_for_cose_key,
+                               struct q_useful_buf_c x_cord, struct q_useful_buf_c y_cord)
+{
+    uint32_t                  return_value;
+    QCBORError                qcbor_result;
+    QCBOREncodeContext        cbor_encode_ctx;
+    int32_t                   cose_curve_id = P_256;
+    struct q_useful_buf_c     encoded_key_id;
+
+    /* Get the public key x and y */
+    /* Encode it into a COSE_Key structure */
+    QCBOREncode_Init(&cbor_encode_ctx, buffer_for_cose_key);
+    QCBOREncode_OpenMap(&cbor_encode_ctx);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode_ctx,
+                               COSE_KEY_COMMON_KTY,
+                               COSE_KEY_TYPE_EC2);
+    QCBOREncode_AddInt64ToMapN(&cbor_encode_ctx,
+                               COSE_KEY_PARAM_CRV,
+                               cose_curve_id);
+    QCBOREncode_AddBytesToMapN(&cbor_encode_ctx,
+                               COSE_KEY_PARAM_X_COORDINATE,
+                               x_cord);
+    QCBOREncode_AddBytesToMapN(&cbor_encode_ctx,
+                               COSE_KEY_PARAM_Y_COORDINATE,
+                               y_cord);
+    QCBOREncode_CloseMap(&cbor_encode_ctx);
+
+    qcbor_result = QCBOREncode_Finish(&cbor_encode_ctx, &encoded_key_id);
+    if (qcbor_result != QCBOR_SUCCESS)
+    {
+        /* Mainly means that the COSE_Key was too big for buffer_for_cose_key */
+        return_value = PAL_ATTEST_ERR_PROTECTED_HEADERS;
+        goto Done;
+    }
+
+    /* Finish up and return */
+    *cose_key = encoded_key_id;
+    return_value = PAL_ATTEST_SUCCESS;
+
+Done:
+    return return_value;
+}
+
+
+/* Offset of the next data item in the buffer being decoded */
+#define DECODE_OFFSET(decode_context)   ((uint32_t)UsefulInputBuf_Tell(&(decode_context)->InBuf))
+
+/* Data types of the Arm claims, indexed by EAT_CBOR_ARM_RANGE_BASE - label */
+static const uint8_t arm_claim_type[] = {
+    QCBOR_TYPE_TEXT_STRING,     /* Profile definition */
+    QCBOR_TYPE_INT64,           /* Client ID */
+    QCBOR_TYPE_INT64,           /* Security lifecycle */
+    QCBOR_TYPE_BYTE_STRING,     /* Implementation ID */
+    QCBOR_TYPE_BYTE_STRING,     /* Boot seed */
+    QCBOR_TYPE_TEXT_STRING,     /* Hardware version */
+    QCBOR_TYPE_ARRAY,           /* SW components */
+    QCBOR_TYPE_NONE,            /* No SW components, not checked */
+    QCBOR_TYPE_BYTE_STRING,     /* Nonce */
+    QCBOR_TYPE_BYTE_STRING,     /* UEID */
+    QCBOR_TYPE_TEXT_STRING,     /* Origination */
+};
+
+/* Data types of the SW component claims, indexed by label */
+static const uint8_t sw_component_claim_type[] = {
+    QCBOR_TYPE_NONE,
+    QCBOR_TYPE_TEXT_STRING,     /* Type */
+    QCBOR_TYPE_BYTE_STRING,     /* Measurement */
+    QCBOR_TYPE_INT64,           /* Epoch */
+    QCBOR_TYPE_TEXT_STRING,     /* Version */
+    QCBOR_TYPE_BYTE_STRING,     /* Signer ID */
+    QCBOR_TYPE_TEXT_STRING,     /* Measurement description */
+};
+
+/* Index of the claims of the last verified token */
+static pal_attest_claim_t token_claims[PAL_ATTEST_MAX_CLAIMS];
+
+static int index_map_entries(QCBORDecodeContext *decode_context, uint16_t count,
+                             pal_attest_claim_index_t *index, uint8_t component);
+
+static void index_init(pal_attest_claim_index_t *index, pal_attest_claim_t *claims,
+                       uint32_t capacity)
+{
+    index->claims = claims;
+    index->capacity = capacity;
+    index->count = 0;
+    index->sw_component_count = 0;
+}
+
+static int index_add_claim(pal_attest_claim_index_t *index, QCBORItem *item,
+                           uint32_t offset, uint8_t component)
+{
+    pal_attest_claim_t      *claim;
+
+    if (index->count == index->capacity)
+    {
+        return PAL_ATTEST_TOKEN_NOT_SUPPORTED;
+    }
+
+    claim = &index->claims[index->count++];
+    claim->label = item->label.int64;
+    claim->offset = offset;
+    claim->data_type = item->uDataType;
+    claim->component = component;
+
+    if (item->uDataType == QCBOR_TYPE_INT64)
+    {
+        claim->val.int64 = item->val.int64;
+    }
+    else if (item->uDataType == QCBOR_TYPE_BYTE_STRING ||
+             item->uDataType == QCBOR_TYPE_TEXT_STRING)
+    {
+        claim->val.string = item->val.string;
+    }
+    else if (item->uDataType == QCBOR_TYPE_MAP || item->uDataType == QCBOR_TYPE_ARRAY)
+    {
+        claim->val.count = item->val.uCount;
+    }
+
+    return PAL_ATTEST_SUCCESS;
+}
+
+/**
+    @brief    - This API will skip the items nested in a map or an array
+    @param    - decode_context : Decoder positioned after the map or array item
+                item           : The map or array item
+    @return   - error status
+**/
+static int skip_nested_items(QCBORDecodeContext *decode_context, QCBORItem *item)
+{
+    uint8_t                 nest_level = item->uNestingLevel;
+    QCBORItem               nested = *item;
+
+    while (nested.uNextNestLevel > nest_level)
+    {
+        if (QCBORDecode_GetNext(decode_context, &nested) != QCBOR_SUCCESS)
+        {
+            return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+        }
+    }
+
+    return PAL_ATTEST_SUCCESS;
+}
+
+/**
+    @brief    - This API will index the maps of the SW components array
+    @param    - decode_context : Decoder positioned after the array item
+                array          : The SW components array item
+                index          : Claim index
+    @return   - error status
+**/
+static int index_sw_components(QCBORDecodeContext *decode_context, QCBORItem *array,
+                               pal_attest_claim_index_t *index)
+{
+    QCBORItem               item;
+    uint16_t                i;
+    int                     status;
+
+    if (array->val.uCount > PAL_ATTEST_MAX_SW_COMPONENTS)
+    {
+        return PAL_ATTEST_TOKEN_NOT_SUPPORTED;
+    }
+
+    for (i = 0; i < array->val.uCount; i++)
+    {
+        if (QCBORDecode_GetNext(decode_context, &item) != QCBOR_SUCCESS ||
+            item.uDataType != QCBOR_TYPE_MAP)
+        {
+            return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+        }
+
+        status = index_map_entries(decode_context, item.val.uCount, index, (uint8_t)i);
+        if (status != PAL_ATTEST_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    index->sw_component_count = array->val.uCount;
+    return PAL_ATTEST_SUCCESS;
+}
+
+/**
+    @brief    - This API will index the entries of a map. Entries with an integer label
+                are recorded, the SW components array of the top level map is indexed
+                as well. Other nested items are skipped.
+    @param    - decode_context : Decoder positioned after the map item
+                count          : Number of entries of the map
+                index          : Claim index
+                component      : SW component number of the map or PAL_ATTEST_TOP_LEVEL_CLAIM
+    @return   - error status
+**/
+static int index_map_entries(QCBORDecodeContext *decode_context, uint16_t count,
+                             pal_attest_claim_index_t *index, uint8_t component)
+{
+    QCBORItem               item;
+    uint32_t                offset;
+    int                     status;
+
+    while (count--)
+    {
+        offset = DECODE_OFFSET(decode_context);
+        if (QCBORDecode_GetNext(decode_context, &item) != QCBOR_SUCCESS)
+        {
+            return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+        }
+
+        if (item.uLabelType == QCBOR_TYPE_INT64)
+        {
+            status = index_add_claim(index, &item, offset, component);
+            if (status != PAL_ATTEST_SUCCESS)
+            {
+                return status;
+            }
+
+            if (component == PAL_ATTEST_TOP_LEVEL_CLAIM &&
+                item.label.int64 == EAT_CBOR_ARM_LABEL_SW_COMPONENTS &&
+                item.uDataType == QCBOR_TYPE_ARRAY)
+            {
+                status = index_sw_components(decode_context, &item, index);
+                if (status != PAL_ATTEST_SUCCESS)
+                {
+                    return status;
+                }
+                continue;
+            }
+        }
+
+        if (item.uDataType == QCBOR_TYPE_MAP || item.uDataType == QCBOR_TYPE_ARRAY)
+        {
+            status = skip_nested_items(decode_context, &item);
+            if (status != PAL_ATTEST_SUCCESS)
+            {
+                return status;
+            }
+        }
+    }
+
+    return PAL_ATTEST_SUCCESS;
+}
+
+/**
+    @brief    - This API will index the map at the decoder position in one pass
+    @param    - decode_context : Decoder positioned at a map
+                index          : Claim index
+    @return   - error status
+**/
+static int index_map(QCBORDecodeContext *decode_context, pal_attest_claim_index_t *index)
+{
+    QCBORItem               item;
+
+    index->count = 0;
+    index->sw_component_count = 0;
+
+    if (QCBORDecode_GetNext(decode_context, &item) != QCBOR_SUCCESS ||
+        item.uDataType != QCBOR_TYPE_MAP)
+    {
+        return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+    }
+
+    return index_map_entries(decode_context, item.val.uCount, index, PAL_ATTEST_TOP_LEVEL_CLAIM);
+}
+
+/**
+    @brief    - This API will index the claims of a CBOR encoded map, including the
+                claims of each SW component, in one decoder pass. The strings of the
+                index point into the given buffer.
+    @param    - buffer : CBOR encoded map, e.g. the payload of the token
+                index  : Claim index, its claims and capacity must be set
+    @return   - error status
+**/
+int32_t pal_attest_index_claims(struct q_useful_buf_c buffer, pal_attest_claim_index_t *index)
+{
+    QCBORDecodeContext      decode_context;
+    int32_t                 status;
+
+    QCBORDecode_Init(&decode_context, buffer, QCBOR_DECODE_MODE_NORMAL);
+
+    status = index_map(&decode_context, index);
+    if (status != PAL_ATTEST_SUCCESS)
+    {
+        return status;
+    }
+
+    if (QCBORDecode_Finish(&decode_context) != QCBOR_SUCCESS)
+    {
+        return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+    }
+
+    return PAL_ATTEST_SUCCESS;
+}
+
+/**
+    @brief    - This API will look up a claim in the index
+    @param    - index     : Claim index
+                label     : Label of the claim
+                component : SW component number or PAL_ATTEST_TOP_LEVEL_CLAIM
+    @return   - The claim, NULL if it is not present
+**/
+const pal_attest_claim_t *pal_attest_find_claim(const pal_attest_claim_index_t *index,
+                                                int64_t label, uint8_t component)
+{
+    uint32_t                i;
+
+    for (i = 0; i < index->count; i++)
+    {
+        if (index->claims[i].label == label && index->claims[i].component == component)
+        {
+            return &index->claims[i];
+        }
+    }
+
+    return NULL;
+}
+
+static int parse_unprotected_headers(QCBORDecodeContext *decode_context,
+                                     struct q_useful_buf_c *child)
+{
+    pal_attest_claim_t          params[PAL_ATTEST_MAX_HEADER_PARAMS];
+    pal_attest_claim_index_t    index;
+    const pal_attest_claim_t    *kid;
+
+    index_init(&index, params, PAL_ATTEST_MAX_HEADER_PARAMS);
+    if (index_map(decode_context, &index))
+    {
+        return PAL_ATTEST_ERROR;
+    }
+
+    kid = pal_attest_find_claim(&index, COSE_HEADER_PARAM_KID, PAL_ATTEST_TOP_LEVEL_CLAIM);
+    if (kid == NULL || kid->data_type != QCBOR_TYPE_BYTE_STRING)
+    {
+        return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+    }
+
+    *child = kid->val.string;
+
+    return PAL_ATTEST_SUCCESS;
+}
+
+static int parse_protected_headers(struct q_useful_buf_c protected_headers,
+                                   int32_t *alg_id)
+{
+    pal_attest_claim_t          params[PAL_ATTEST_MAX_HEADER_PARAMS];
+    pal_attest_claim_index_t    index;
+    const pal_attest_claim_t    *alg;
+
+    index_init(&index, params, PAL_ATTEST_MAX_HEADER_PARAMS);
+    if (pal_attest_index_claims(protected_headers, &index))
+    {
+        return PAL_ATTEST_ERROR;
+    }
+
+    alg = pal_attest_find_claim(&index, COSE_HEADER_PARAM_ALG, PAL_ATTEST_TOP_LEVEL_CLAIM);
+    if (alg == NULL)
+    {
+        return PAL_ATTEST_ERROR;
+    }
+
+    if ((alg->data_type != QCBOR_TYPE_INT64) || (alg->val.int64 > INT32_MAX))
+    {
+        return PAL_ATTEST_ERROR;
+    }
+
+    *alg_id = (int32_t)alg->val.int64;
+
+    return PAL_ATTEST_SUCCESS;
+}
+
+/**
+    @brief    - This API will verify the claims
+    @param    - index               : Claim index of the token payload
+                completed_challenge : Buffer containing the challenge
+    @return   - error status
+**/
+static int check_claims(const pal_attest_claim_index_t *index,
+                        struct q_useful_buf_c completed_challenge)
+{
+    const pal_attest_claim_t    *claim;
+    uint32_t                    i;
+    uint32_t                    mandatory_claims = 0;
+    uint8_t                     sw_component_claims[PAL_ATTEST_MAX_SW_COMPONENTS] = {0};
+    uint8_t                     data_type;
+
+    /* Check the data type of each claim */
+    for (i = 0; i < index->count; i++)
+    {
+        claim = &index->claims[i];
+
+        if (claim->component != PAL_ATTEST_TOP_LEVEL_CLAIM)
+        {
+            if (claim->label < EAT_CBOR_SW_COMPONENT_TYPE ||
+                claim->label > EAT_CBOR_SW_COMPONENT_MEASUREMENT_DESC)
+            {
+                continue;
+            }
+
+            sw_component_claims[claim->component] |= 1 << claim->label;
+            if (claim->data_type != sw_component_claim_type[claim->label])
+            {
+                return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+            }
+            continue;
+        }
+
+        /* ToDo: Add other claim types */
+        if (claim->label > EAT_CBOR_ARM_RANGE_BASE ||
+            claim->label < EAT_CBOR_ARM_LABEL_ORIGINATION)
+        {
+            continue;
+        }
+
+        mandatory_claims |= 1 << (EAT_CBOR_ARM_RANGE_BASE - claim->label);
+
+        if (claim->label == EAT_CBOR_ARM_LABEL_NONCE)
+        {
+            if (claim->data_type != QCBOR_TYPE_BYTE_STRING)
+            {
+                return PAL_ATTEST_TOKEN_NOT_SUPPORTED;
+            }
+
+            /* Given challenge vs challenge in token */
+            if (UsefulBuf_Compare(claim->val.string, completed_challenge))
+            {
+                return PAL_ATTEST_TOKEN_CHALLENGE_MISMATCH;
+            }
+            continue;
+        }
+
+        data_type = arm_claim_type[EAT_CBOR_ARM_RANGE_BASE - claim->label];
+        if (data_type != QCBOR_TYPE_NONE && claim->data_type != data_type)
+        {
+            return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+        }
+    }
+
+    if ((mandatory_claims & MANDATORY_CLAIM_WITH_SW_COMP) == MANDATORY_CLAIM_WITH_SW_COMP)
+    {
+        /* Each SW component has its own mandatory claims */
+        if (index->sw_component_count == 0)
+        {
+            return PAL_ATTEST_TOKEN_NOT_ALL_MANDATORY_CLAIMS;
+        }
+
+        for (i = 0; i < index->sw_component_count; i++)
+        {
+            if ((sw_component_claims[i] & MANDATORY_SW_COMP) != MANDATORY_SW_COMP)
+            {
+                return PAL_ATTEST_TOKEN_NOT_ALL_MANDATORY_CLAIMS;
+            }
+        }
+    }
+    else if ((mandatory_claims & MANDATORY_CLAIM_NO_SW_COMP) != MANDATORY_CLAIM_NO_SW_COMP)
+    {
+        return PAL_ATTEST_TOKEN_NOT_ALL_MANDATORY_CLAIMS;
+    }
+
+    return PAL_ATTEST_SUCCESS;
+}
+
+/**
+    @brief    - This API will check the key ID of the token against the hash of the
+                attestation public key
+    @param    - kid : Key ID from the unprotected headers
+    @return   - error status
+**/
+static int32_t check_key_id(struct q_useful_buf_c kid)
+{
+    int32_t             status;
+    struct q_useful_buf_c x_cord;
+    struct q_useful_buf_c y_cord;
+    struct q_useful_buf_c cose_key_to_hash;
+    struct q_useful_buf_c key_hash;
+    USEFUL_BUF_MAKE_STACK_UB(buf_to_hold_x_coord, T_COSE_CRYPTO_EC_P256_COORD_SIZE);
+    USEFUL_BUF_MAKE_STACK_UB(buf_to_hold_y_coord, T_COSE_CRYPTO_EC_P256_COORD_SIZE);
+    USEFUL_BUF_MAKE_STACK_UB(buffer_for_kid, T_COSE_CRYPTO_SHA256_SIZE);
+    USEFUL_BUF_MAKE_STACK_UB(buffer_for_cose_key, MAX_ENCODED_COSE_KEY_SIZE);
+
+    memcpy(buf_to_hold_x_coord.ptr, (const void *)attest_key.pubx_key, attest_key.pubx_key_size);
+    memcpy(buf_to_hold_y_coord.ptr, (const void *)attest_key.puby_key, attest_key.puby_key_size);
+
+    /* Update size */
+    buf_to_hold_x_coord.len = attest_key.pubx_key_size;
+    buf_to_hold_y_coord.len = attest_key.puby_key_size;
+
+    x_cord.ptr = buf_to_hold_x_coord.ptr;
+    x_cord.len = buf_to_hold_x_coord.len;
+    y_cord.ptr = buf_to_hold_y_coord.ptr;
+    y_cord.len = buf_to_hold_y_coord.len;
+
+    /* Encode the given public key */
+    status = pal_encode_cose_key(&cose_key_to_hash, buffer_for_cose_key, x_cord, y_cord);
+    if (status != PAL_ATTEST_SUCCESS)
+        return status;
+
+    /* Create hash of the given public key */
+    status = pal_create_sha256(cose_key_to_hash, buffer_for_kid, &key_hash);
+    if (status != PSA_SUCCESS)
+        return status;
+
+    /* Compare the hash of the public key in token and hash of the given public key */
+    if (kid.len != key_hash.len)
+    {
+        return PAL_ATTEST_HASH_LENGTH_MISMATCH;
+    }
+
+    if (memcmp(kid.ptr, key_hash.ptr, kid.len) != 0)
+    {
+        return PAL_ATTEST_HASH_MISMATCH;
+    }
+
+    return PAL_ATTEST_SUCCESS;
+}
+
+/**
+    @brief    - This API will parse the COSE_Sign1 array up to the payload and check
+                the headers
+    @param    - decode_context    : Decoder positioned at the start of the token
+                protected_headers : Returns the protected headers
+                cose_algorithm_id : Returns the COSE signature algorithm
+    @return   - error status
+**/
+static int32_t parse_sign1_headers(QCBORDecodeContext *decode_context,
+                                   struct q_useful_buf_c *protected_headers,
+                                   int32_t *cose_algorithm_id)
+{
+    int32_t             status;
+    QCBORItem           item;
+    struct q_useful_buf_c kid;
+
+/*
+    -------------------------
+    |  CBOR Array Type      |
+    -------------------------
+    |  Protected Headers    |
+    -------------------------
+    |  Unprotected Headers  |
+    -------------------------
+    |  Payload              |
+    -------------------------
+    |  Signature            |
+    -------------------------
+*/
+
+    /* Get the Header */
+    QCBORDecode_GetNext(decode_context, &item);
+
+    /* Check the CBOR Array type. Check if the count is 4.
+     * Only COSE_SIGN1 is supported now.
+     */
+    if (item.uDataType != QCBOR_TYPE_ARRAY || item.val.uCount != 4 ||
+       !QCBORDecode_IsTagged(decode_context, &item, CBOR_TAG_COSE_SIGN1))
+        return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+
+    /* Get the next headers */
+    QCBORDecode_GetNext(decode_context, &item);
+    if (item.uDataType != QCBOR_TYPE_BYTE_STRING)
+        return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+
+    *protected_headers = item.val.string;
+
+    /* Parse the protected headers and check the data type and value*/
+    status = parse_protected_headers(*protected_headers, cose_algorithm_id);
+    if (status != PAL_ATTEST_SUCCESS)
+        return status;
+
+    /* Parse the unprotected headers and check the data type and value */
+    status = parse_unprotected_headers(decode_context, &kid);
+    if (status != PAL_ATTEST_SUCCESS)
+        return status;
+
+    /* Check the key ID against the attestation public key */
+    return check_key_id(kid);
+}
+
+/**
+    @brief    - This API will verify the attestation token
+    @param    - challenge       : The buffer containing the challenge
+                challenge_size  : Size of the challenge buffer
+                token           : The buffer containing the attestation token
+                token_size      : Size of the token buffer
+    @return   - error status
+**/
+int32_t pal_initial_attest_verify_token(uint8_t *challenge, size_t challenge_size,
+                                        uint8_t *token, size_t token_size)
+{
+    int32_t             status = PAL_ATTEST_SUCCESS;
+    int32_t             cose_algorithm_id;
+    QCBORItem           item;
+    QCBORDecodeContext  decode_context;
+    pal_attest_claim_index_t claim_index;
+    struct q_useful_buf_c completed_challenge;
+    struct q_useful_buf_c completed_token;
+    struct q_useful_buf_c payload;
+    struct q_useful_buf_c signature;
+    struct q_useful_buf_c protected_headers;
+    struct q_useful_buf_c token_hash;
+    USEFUL_BUF_MAKE_STACK_UB(buffer_for_token_hash, T_COSE_CRYPTO_SHA256_SIZE);
+
+    /* Construct the token buffer for validation */
+    completed_token.ptr = token;
+    completed_token.len = token_size;
+
+    /* Construct the challenge buffer for validation */
+    completed_challenge.ptr = challenge;
+    completed_challenge.len = challenge_size;
+
+    /* Initialize the decorder */
+    QCBORDecode_Init(&decode_context, completed_token, QCBOR_DECODE_MODE_NORMAL);
+
+    /* Check the array and the headers */
+    status = parse_sign1_headers(&decode_context, &protected_headers, &cose_algorithm_id);
+    if (status != PAL_ATTEST_SUCCESS)
+        return status;
+
+    /* Get the payload */
+    QCBORDecode_GetNext(&decode_context, &item);
+    if (item.uDataType != QCBOR_TYPE_BYTE_STRING)
+        return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+
+    payload = item.val.string;
+
+    /* Get the digital signature */
+    QCBORDecode_GetNext(&decode_context, &item);
+    if (item.uDataType != QCBOR_TYPE_BYTE_STRING)
+        return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+
+    signature = item.val.string;
+
+    /* Compute the hash from the token */
+    status = pal_compute_hash(cose_algorithm_id, buffer_for_token_hash, &token_hash,
+                              protected_headers, payload);
+    if (status != PAL_ATTEST_SUCCESS)
+        return status;
+
+    /* Verify the signature */
+    status = pal_crypto_pub_key_verify(cose_algorithm_id, token_hash, signature);
+    if (status != PAL_ATTEST_SUCCESS)
+        return status;
+
+    /* Index the claims of the payload in one pass and check them from the index */
+    index_init(&claim_index, token_claims, PAL_ATTEST_MAX_CLAIMS);
+    status = pal_attest_index_claims(payload, &claim_index);
+    if (status != PAL_ATTEST_SUCCESS)
+        return status;
+
+    status = check_claims(&claim_index, completed_challenge);
+    if (status != PAL_ATTEST_SUCCESS)
+        return status;
+
+    return PAL_ATTEST_SUCCESS;
+}
+
+/* Streaming verification. The token is passed in chunks of any size. Only the
+ * COSE_Sign1 headers and the signature are buffered; the payload is hashed and its
+ * claims are indexed as the bytes arrive.
+ */
+enum stream_state {
+    STREAM_IDLE = 0,
+    STREAM_HEADERS,
+    STREAM_PAYLOAD,
+    STREAM_SIGNATURE_HEAD,
+    STREAM_SIGNATURE,
+    STREAM_DONE,
+    STREAM_FAILED,
+};
+
+typedef struct {
+    uint8_t                 major;
+    uint32_t                remaining;  /* Items left, keys and values count separately */
+} stream_container_t;
+
+typedef struct {
+    uint32_t                state;
+    int32_t                 status;
+    int32_t                 cose_algorithm_id;
+    psa_hash_operation_t    psa_hash;
+    uint8_t                 challenge[PSA_INITIAL_ATTEST_CHALLENGE_SIZE_64];
+    size_t                  challenge_size;
+    uint8_t                 headers[PAL_ATTEST_STREAM_HEADERS_SIZE];
+    size_t                  headers_len;
+    size_t                  payload_left;
+    uint8_t                 signature[PAL_ATTEST_MAX_SIGNATURE_SIZE];
+    size_t                  signature_size;
+    size_t                  signature_len;
+    /* Claim walker */
+    uint8_t                 head[9];
+    uint8_t                 head_len;
+    uint32_t                head_offset;
+    uint32_t                offset;
+    size_t                  string_left;
+    bool_t                  string_is_nonce;
+    bool_t                  payload_done;
+    uint32_t                depth;
+    stream_container_t      stack[PAL_ATTEST_STREAM_MAX_DEPTH];
+    int64_t                 label;
+    bool_t                  label_valid;
+    uint32_t                label_offset;
+    uint32_t                sw_array_depth;
+    uint8_t                 nonce[PSA_INITIAL_ATTEST_CHALLENGE_SIZE_64];
+    size_t                  nonce_len;
+    pal_attest_claim_index_t index;
+} pal_attest_stream_t;
+
+static pal_attest_stream_t  attest_stream;
+
+/* Returned by the stream parsers while the buffered bytes do not hold a complete item */
+#define STREAM_NEED_MORE            (-1)
+
+/**
+    @brief    - This API returns the size of a CBOR head from its initial byte
+    @param    - initial_byte : First byte of the head
+    @return   - Size in bytes, 0 for indefinite lengths and reserved values
+**/
+static uint8_t cbor_head_size(uint8_t initial_byte)
+{
+    uint8_t     info = initial_byte & 0x1F;
+
+    if (info < 24)
+        return 1;
+    if (info > 27)
+        return 0;
+
+    return 1 + (1 << (info - 24));
+}
+
+/**
+    @brief    - This API will decode a complete CBOR head
+    @param    - head  : Head bytes
+                major : Returns the major type
+    @return   - Argument of the head
+**/
+static uint64_t cbor_head_decode(const uint8_t *head, uint8_t *major)
+{
+    uint64_t    argument = 0;
+    uint8_t     size = cbor_head_size(head[0]);
+    uint8_t     i;
+
+    *major = head[0] >> 5;
+    if (size == 1)
+        return head[0] & 0x1F;
+
+    for (i = 1; i < size; i++)
+        argument = (argument << 8) | head[i];
+
+    return argument;
+}
+
+/**
+    @brief    - This API returns the size of the CBOR item at the start of a buffer
+    @param    - buf   : Buffer
+                len   : Number of bytes in the buffer
+                size  : Returns the size of the item, including nested items
+                depth : Nesting depth of the item
+    @return   - error status, STREAM_NEED_MORE if the item is not complete in the buffer
+**/
+static int32_t cbor_item_size(const uint8_t *buf, size_t len, size_t *size, uint32_t depth)
+{
+    uint8_t     head_size, major;
+    uint64_t    argument, items;
+    size_t      used, nested;
+    int32_t     status;
+
+    if (len == 0)
+        return STREAM_NEED_MORE;
+
+    head_size = cbor_head_size(buf[0]);
+    if (head_size == 0 || depth == PAL_ATTEST_STREAM_MAX_DEPTH)
+        return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+    if (head_size > len)
+        return STREAM_NEED_MORE;
+
+    argument = cbor_head_decode(buf, &major);
+    used = head_size;
+
+    if (major == 2 || major == 3)
+    {
+        if (argument > len - used)
+            return STREAM_NEED_MORE;
+        used += argument;
+    }
+    else if (major == 4 || major == 5 || major == 6)
+    {
+        items = (major == 4) ? argument : (major == 5) ? 2 * argument : 1;
+        while (items--)
+        {
+            status = cbor_item_size(buf + used, len - used, &nested, depth + 1);
+            if (status != PAL_ATTEST_SUCCESS)
+                return status;
+            used += nested;
+        }
+    }
+
+    *size = used;
+    return PAL_ATTEST_SUCCESS;
+}
+
+/**
+    @brief    - This API will account a complete item to its enclosing containers
+    @param    - stream : Stream context
+    @return   - void
+**/
+static void stream_item_done(pal_attest_stream_t *stream)
+{
+    while (stream->depth)
+    {
+        if (--stream->stack[stream->depth - 1].remaining)
+            return;
+
+        /* The container is complete, it is an item of its parent */
+        stream->depth--;
+        if (stream->sw_array_depth > stream->depth)
+            stream->sw_array_depth = 0;
+    }
+
+    stream->payload_done = 1;
+}
+
+/**
+    @brief    - This API will process a CBOR head of the payload
+    @param    - stream   : Stream context
+                major    : Major type
+                argument : Argument of the head
+    @return   - error status
+**/
+static int32_t stream_process_head(pal_attest_stream_t *stream, uint8_t major, uint64_t argument)
+{
+    stream_container_t  *parent = stream->depth ? &stream->stack[stream->depth - 1] : NULL;
+    QCBORItem           item;
+    uint8_t             component = PAL_ATTEST_TOP_LEVEL_CLAIM;
+    bool_t              record = 0;
+    int32_t             status;
+
+    /* Tags apply to the next item */
+    if (major == 6)
+        return PAL_ATTEST_SUCCESS;
+
+    if (stream->payload_done || (parent == NULL && major != 5))
+        return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+
+    /* Map key, only integer labels are recorded */
+    if (parent != NULL && parent->major == 5 && (parent->remaining % 2) == 0)
+    {
+        stream->label_valid = (major == 0 || major == 1) && argument <= INT64_MAX;
+        stream->label = (major == 0) ? (int64_t)argument : -1 - (int64_t)argument;
+        stream->label_offset = stream->head_offset;
+        stream->string_is_nonce = 0;
+
+        if ((major == 2 || major == 3) && argument)
+            stream->string_left = argument;
+        else if (major == 4 || major == 5)
+            return PAL_ATTEST_TOKEN_NOT_SUPPORTED;
+        else
+            stream_item_done(stream);
+
+        return PAL_ATTEST_SUCCESS;
+    }
+
+    /* Claims of the payload map and of the maps of the SW components array */
+    if (parent != NULL && parent->major == 5 && stream->label_valid)
+    {
+        if (stream->depth == 1)
+        {
+            record = 1;
+        }
+        else if (stream->sw_array_depth && stream->depth == stream->sw_array_depth + 1)
+        {
+            record = 1;
+            component = stream->index.sw_component_count - 1;
+        }
+    }
+
+    if (record)
+    {
+        memset(&item, 0, sizeof(item));
+        item.label.int64 = stream->label;
+        switch (major)
+        {
+            case 0:
+            case 1:
+                if (argument <= INT64_MAX)
+                {
+                    item.uDataType = QCBOR_TYPE_INT64;
+                    item.val.int64 = (major == 0) ? (int64_t)argument : -1 - (int64_t)argument;
+                }
+                break;
+            case 2:
+            case 3:
+                item.uDataType = (major == 2) ? QCBOR_TYPE_BYTE_STRING : QCBOR_TYPE_TEXT_STRING;
+                item.val.string.len = argument;
+                break;
+            default:
+                item.uDataType = (major == 4) ? QCBOR_TYPE_ARRAY :
+                                 (major == 5) ? QCBOR_TYPE_MAP : QCBOR_TYPE_NONE;
+                item.val.uCount = (uint16_t)argument;
+                break;
+        }
+
+        /* The nonce is kept to be compared with the challenge */
+        stream->string_is_nonce = (component == PAL_ATTEST_TOP_LEVEL_CLAIM &&
+                                   stream->label == EAT_CBOR_ARM_LABEL_NONCE && major == 2);
+        if (stream->string_is_nonce)
+        {
+            if (argument > sizeof(stream->nonce))
+                return PAL_ATTEST_TOKEN_CHALLENGE_MISMATCH;
+            item.val.string.ptr = stream->nonce;
+            stream->nonce_len = 0;
+        }
+
+        status = index_add_claim(&stream->index, &item, stream->label_offset, component);
+        if (status != PAL_ATTEST_SUCCESS)
+            return status;
+    }
+    else
+    {
+        stream->string_is_nonce = 0;
+    }
+
+    if ((major == 2 || major == 3) && argument)
+    {
+        stream->string_left = argument;
+    }
+    else if ((major == 4 || major == 5) && argument)
+    {
+        if (stream->depth == PAL_ATTEST_STREAM_MAX_DEPTH || argument > UINT32_MAX / 2)
+            return PAL_ATTEST_TOKEN_NOT_SUPPORTED;
+
+        /* A map of the SW components array is a new component */
+        if (stream->sw_array_depth && stream->depth == stream->sw_array_depth)
+        {
+            if (major != 5)
+                return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+            if (stream->index.sw_component_count == PAL_ATTEST_MAX_SW_COMPONENTS)
+                return PAL_ATTEST_TOKEN_NOT_SUPPORTED;
+            stream->index.sw_component_count++;
+        }
+
+        if (record && component == PAL_ATTEST_TOP_LEVEL_CLAIM && major == 4 &&
+            stream->label == EAT_CBOR_ARM_LABEL_SW_COMPONENTS)
+        {
+            stream->sw_array_depth = stream->depth + 1;
+        }
+
+        stream->stack[stream->depth].major = major;
+        stream->stack[stream->depth].remaining = (major == 5) ? 2 * argument : argument;
+        stream->depth++;
+    }
+    else
+    {
+        stream_item_done(stream);
+    }
+
+    return PAL_ATTEST_SUCCESS;
+}
+
+/**
+    @brief    - This API will hash part of the payload and index its claims
+    @param    - stream : Stream context
+                data   : Payload bytes
+                len    : Number of bytes
+    @return   - error status
+**/
+static int32_t stream_payload(pal_attest_stream_t *stream, const uint8_t *data, size_t len)
+{
+    struct q_useful_buf_c   part = {data, len};
+    uint8_t                 major, head_size;
+    uint64_t                argument;
+    size_t                  n;
+    int32_t                 status;
+
+    pal_cose_crypto_hash_update(&stream->psa_hash, part);
+
+    while (len)
+    {
+        if (stream->string_left)
+        {
+            n = (len < stream->string_left) ? len : stream->string_left;
+            if (stream->string_is_nonce)
+            {
+                memcpy(stream->nonce + stream->nonce_len, data, n);
+                stream->nonce_len += n;
+            }
+            stream->string_left -= n;
+            stream->offset += n;
+            data += n;
+            len -= n;
+            if (stream->string_left == 0)
+                stream_item_done(stream);
+            continue;
+        }
+
+        if (stream->head_len == 0)
+            stream->head_offset = stream->offset;
+
+        stream->head[stream->head_len++] = *data++;
+        stream->offset++;
+        len--;
+
+        head_size = cbor_head_size(stream->head[0]);
+        if (head_size == 0)
+            return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+        if (stream->head_len < head_size)
+            continue;
+
+        stream->head_len = 0;
+        argument = cbor_head_decode(stream->head, &major);
+        status = stream_process_head(stream, major, argument);
+        if (status != PAL_ATTEST_SUCCESS)
+            return status;
+    }
+
+    return PAL_ATTEST_SUCCESS;
+}
+
+/**
+    @brief    - This API will parse the buffered COSE_Sign1 headers once they are
+                complete, up to and including the head of the payload
+    @param    - stream : Stream context
+                used   : Returns the number of buffered bytes up to the payload
+    @return   - error status, STREAM_NEED_MORE if more bytes are needed
+**/
+static int32_t stream_headers(pal_attest_stream_t *stream, size_t *used)
+{
+    QCBORDecodeContext      decode_context;
+    struct q_useful_buf_c   headers;
+    struct q_useful_buf_c   protected_headers;
+    uint8_t                 major, head_size;
+    uint64_t                argument;
+    size_t                  size, offset = 0;
+    int32_t                 status;
+    int                     i;
+
+    /* Tag, array, protected headers and unprotected headers */
+    for (i = 0; i < 4; i++)
+    {
+        if (i < 2)
+        {
+            if (offset == stream->headers_len)
+                return STREAM_NEED_MORE;
+            size = cbor_head_size(stream->headers[offset]);
+            if (size == 0)
+                return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+            if (size > stream->headers_len - offset)
+                return STREAM_NEED_MORE;
+        }
+        else
+        {
+            status = cbor_item_size(stream->headers + offset, stream->headers_len - offset,
+                                    &size, 0);
+            if (status != PAL_ATTEST_SUCCESS)
+                return status;
+        }
+        offset += size;
+    }
+
+    /* Head of the payload */
+    if (offset == stream->headers_len)
+        return STREAM_NEED_MORE;
+    head_size = cbor_head_size(stream->headers[offset]);
+    if (head_size == 0)
+        return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+    if (head_size > stream->headers_len - offset)
+        return STREAM_NEED_MORE;
+
+    argument = cbor_head_decode(stream->headers + offset, &major);
+    if (major != 2)
+        return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+
+    /* Check the array and the headers */
+    headers.ptr = stream->headers;
+    headers.len = offset;
+    QCBORDecode_Init(&decode_context, headers, QCBOR_DECODE_MODE_NORMAL);
+    status = parse_sign1_headers(&decode_context, &protected_headers,
+                                 &stream->cose_algorithm_id);
+    if (status != PAL_ATTEST_SUCCESS)
+        return status;
+
+    /* Hash the start of the Sig_structure, the payload follows */
+    status = pal_compute_hash_start(&stream->psa_hash, stream->cose_algorithm_id,
+                                    protected_headers, argument);
+    if (status != PAL_ATTEST_SUCCESS)
+        return status;
+
+    stream->payload_left = argument;
+    *used = offset + head_size;
+    return PAL_ATTEST_SUCCESS;
+}
+
+/**
+    @brief    - This API will start the verification of an attestation token passed
+                in chunks
+    @param    - challenge       : The buffer containing the challenge
+                challenge_size  : Size of the challenge buffer
+    @return   - error status
+**/
+int32_t pal_initial_attest_verify_token_start(uint8_t *challenge, size_t challenge_size)
+{
+    pal_attest_stream_t     *stream = &attest_stream;
+
+    if (stream->state >= STREAM_PAYLOAD && stream->state <= STREAM_DONE)
+        psa_hash_abort(&stream->psa_hash);
+
+    memset(stream, 0, sizeof(*stream));
+    if (challenge_size > sizeof(stream->challenge))
+        return PAL_ATTEST_TOKEN_CHALLENGE_MISMATCH;
+
+    memcpy(stream->challenge, challenge, challenge_size);
+    stream->challenge_size = challenge_size;
+    index_init(&stream->index, token_claims, PAL_ATTEST_MAX_CLAIMS);
+    stream->state = STREAM_HEADERS;
+
+    return PAL_ATTEST_SUCCESS;
+}
+
+/**
+    @brief    - This API will pass the next chunk of the token to the verification
+    @param    - chunk      : Next bytes of the token
+                chunk_size : Number of bytes
+    @return   - error status
+**/
+int32_t pal_initial_attest_verify_token_update(uint8_t *chunk, size_t chunk_size)
+{
+    pal_attest_stream_t     *stream = &attest_stream;
+    uint8_t                 major, head_size;
+    size_t                  n, used;
+    int32_t                 status = PAL_ATTEST_SUCCESS;
+
+    while (chunk_size && status == PAL_ATTEST_SUCCESS)
+    {
+        switch (stream->state)
+        {
+            case STREAM_HEADERS:
+                n = sizeof(stream->headers) - stream->headers_len;
+                n = (chunk_size < n) ? chunk_size : n;
+                memcpy(stream->headers + stream->headers_len, chunk, n);
+                stream->headers_len += n;
+
+                status = stream_headers(stream, &used);
+                if (status == STREAM_NEED_MORE)
+                {
+                    /* Wait for the rest of the headers unless they do not fit */
+                    if (stream->headers_len < sizeof(stream->headers))
+                        return PAL_ATTEST_SUCCESS;
+                    status = PAL_ATTEST_TOKEN_NOT_SUPPORTED;
+                }
+                if (status != PAL_ATTEST_SUCCESS)
+                    break;
+
+                /* Bytes of this chunk after the payload head belong to the payload */
+                n -= stream->headers_len - used;
+                stream->headers_len = used;
+                stream->state = STREAM_PAYLOAD;
+                break;
+            case STREAM_PAYLOAD:
+                n = (chunk_size < stream->payload_left) ? chunk_size : stream->payload_left;
+                status = stream_payload(stream, chunk, n);
+                stream->payload_left -= n;
+                if (status == PAL_ATTEST_SUCCESS && stream->payload_left == 0)
+                {
+                    if (!stream->payload_done)
+                        status = PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+                    stream->state = STREAM_SIGNATURE_HEAD;
+                }
+                break;
+            case STREAM_SIGNATURE_HEAD:
+                n = 1;
+                stream->head[stream->head_len++] = *chunk;
+                head_size = cbor_head_size(stream->head[0]);
+                if (head_size == 0)
+                {
+                    status = PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+                    break;
+                }
+                if (stream->head_len < head_size)
+                    break;
+
+                stream->head_len = 0;
+                stream->signature_size = cbor_head_decode(stream->head, &major);
+                if (major != 2 || stream->signature_size > sizeof(stream->signature))
+                {
+                    status = PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+                    break;
+                }
+                stream->state = stream->signature_size ? STREAM_SIGNATURE : STREAM_DONE;
+                break;
+            case STREAM_SIGNATURE:
+                n = stream->signature_size - stream->signature_len;
+                n = (chunk_size < n) ? chunk_size : n;
+                memcpy(stream->signature + stream->signature_len, chunk, n);
+                stream->signature_len += n;
+                if (stream->signature_len == stream->signature_size)
+                    stream->state = STREAM_DONE;
+                break;
+            case STREAM_DONE:
+                /* Bytes after the signature */
+                status = PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+                break;
+            default:
+                return (stream->state == STREAM_FAILED) ? stream->status : PAL_ATTEST_ERROR;
+        }
+
+        chunk += n;
+        chunk_size -= n;
+    }
+
+    if (status != PAL_ATTEST_SUCCESS)
+    {
+        if (stream->state >= STREAM_PAYLOAD)
+            psa_hash_abort(&stream->psa_hash);
+        stream->state = STREAM_FAILED;
+        stream->status = status;
+    }
+
+    return status;
+}
+
+/**
+    @brief    - This API will complete the verification of a token passed in chunks:
+                it checks the signature and then the claims of the payload
+    @param    - void
+    @return   - error status
+**/
+int32_t pal_initial_attest_verify_token_finish(void)
+{
+    pal_attest_stream_t     *stream = &attest_stream;
+    struct q_useful_buf_c   token_hash;
+    struct q_useful_buf_c   signature;
+    struct q_useful_buf_c   challenge;
+    int32_t                 status;
+    USEFUL_BUF_MAKE_STACK_UB(buffer_for_token_hash, T_COSE_CRYPTO_SHA256_SIZE);
+
+    if (stream->state == STREAM_FAILED)
+        return stream->status;
+
+    if (stream->state == STREAM_IDLE)
+        return PAL_ATTEST_ERROR;
+
+    if (stream->state != STREAM_DONE)
+    {
+        /* The token ended early */
+        if (stream->state >= STREAM_PAYLOAD)
+            psa_hash_abort(&stream->psa_hash);
+        stream->state = STREAM_IDLE;
+        return PAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+    }
+
+    stream->state = STREAM_IDLE;
+
+    status = pal_cose_crypto_hash_finish(&stream->psa_hash, buffer_for_token_hash, &token_hash);
+    if (status != PSA_SUCCESS)
+        return PAL_ATTEST_HASH_FAIL;
+
+    /* Verify the signature */
+    signature.ptr = stream->signature;
+    signature.len = stream->signature_size;
+    status = pal_crypto_pub_key_verify(stream->cose_algorithm_id, token_hash, signature);
+    if (status != PAL_ATTEST_SUCCESS)
+        return status;
+
+    /* Check the claims indexed while the payload was hashed */
+    challenge.ptr = stream->challenge;
+    challenge.len = stream->challenge_size;
+    return check_claims(&stream->index, challenge);
+}
@@ -0,0 +1,117 @@
+#/** @file
+# * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+# The suites run as a Linux process. The VAL keeps addresses in the 32-bit addr_t,
+# hence the host executable is built for a 32-bit ABI (-m32).
+if(NOT ${TOOLCHAIN} STREQUAL "HOST_GCC")
+	message(FATAL_ERROR "[PSA] : Error: ${TARGET} must be built with -DTOOLCHAIN=HOST_GCC")
+endif()
+if(${SUITE} IN_LIST PSA_SUITES_FF)
+	message(FATAL_ERROR "[PSA] : Error: ${TARGET} does not support the ${SUITE} suite, it has no SPM")
+endif()
+add_compile_options(-m32)
+
+# PAL C source files part of NSPE library
+list(APPEND PAL_SRC_C_NSPE )
+
+# PAL ASM source files part of NSPE library
+list(APPEND PAL_SRC_ASM_NSPE )
+
+# Listing all the sources required for given target
+list(APPEND PAL_SRC_C_NSPE
+	# driver files will be compiled as part of NSPE
+	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/common/pal_client_api_empty_intf.c
+	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/common/pal_driver_ns_intf.c
+	${PSA_ROOT_DIR}/platform/drivers/nvmem/pal_nvmem.c
+)
+if(("CRYPTO" IN_LIST PSA_SUITE_LIST) OR ("CRYPTO_PERF" IN_LIST PSA_SUITE_LIST))
+	list(APPEND PAL_SRC_C_NSPE
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/crypto/pal_crypto_intf.c
+	)
+endif()
+if(("PROTECTED_STORAGE" IN_LIST PSA_SUITE_LIST) OR ("STORAGE_PERF" IN_LIST PSA_SUITE_LIST))
+	list(APPEND PAL_SRC_C_NSPE
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/protected_storage/pal_protected_storage_intf.c
+	)
+endif()
+if(("INTERNAL_TRUSTED_STORAGE" IN_LIST PSA_SUITE_LIST) OR ("STORAGE_PERF" IN_LIST PSA_SUITE_LIST))
+	list(APPEND PAL_SRC_C_NSPE
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/internal_trusted_storage/pal_internal_trusted_storage_intf.c
+	)
+endif()
+if("INITIAL_ATTESTATION" IN_LIST PSA_SUITE_LIST)
+	list(APPEND PAL_SRC_C_NSPE
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/initial_attestation/pal_attestation_intf.c
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/initial_attestation/pal_attestation_eat.c
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/initial_attestation/pal_attestation_crypto.c
+	)
+endif()
+
+# Create NSPE library
+add_library(${PSA_TARGET_PAL_NSPE_LIB} STATIC ${PAL_SRC_C_NSPE} ${PAL_SRC_ASM_NSPE})
+
+# PSA Include directories
+foreach(psa_inc_path ${PSA_INCLUDE_PATHS})
+	target_include_directories(${PSA_TARGET_PAL_NSPE_LIB} PRIVATE ${psa_inc_path})
+endforeach()
+
+list(APPEND PAL_DRIVER_INCLUDE_PATHS
+	${PSA_ROOT_DIR}/platform/drivers/nvmem
+)
+
+target_include_directories(${PSA_TARGET_PAL_NSPE_LIB} PRIVATE
+	${PAL_DRIVER_INCLUDE_PATHS}
+	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/common
+	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/crypto
+	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/protected_storage
+	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/internal_trusted_storage
+	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/initial_attestation
+)
+
+if("INITIAL_ATTESTATION" IN_LIST PSA_SUITE_LIST)
+target_include_directories(${PSA_TARGET_PAL_NSPE_LIB} PRIVATE
+	${PSA_QCBOR_INCLUDE_PATH}
+)
+endif()
+
+# Host executable. The PSA APIs under test come from the libraries listed in
+# -DPSA_HOST_LIBS=<lib1;lib2..>, e.g. a host build of Mbed Crypto.
+set(PSA_TARGET_HOST_EXE psa_arch_tests)
+add_executable(${PSA_TARGET_HOST_EXE}
+	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/common/pal_host_main.c
+)
+target_include_directories(${PSA_TARGET_HOST_EXE} PRIVATE
+	${CMAKE_CURRENT_BINARY_DIR}
+	${PSA_ROOT_DIR}/val/common
+	${PSA_ROOT_DIR}/val/nspe
+	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/common
+	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/crypto
+)
+foreach(psa_inc_path ${PSA_INCLUDE_PATHS})
+	target_include_directories(${PSA_TARGET_HOST_EXE} PRIVATE ${psa_inc_path})
+endforeach()
+target_link_libraries(${PSA_TARGET_HOST_EXE}
+	-m32
+	-pthread
+	-Wl,--start-group
+	${PSA_TARGET_TEST_COMBINE_LIB}
+	${PSA_TARGET_VAL_NSPE_LIB}
+	${PSA_TARGET_PAL_NSPE_LIB}
+	${PSA_HOST_LIBS}
+	-Wl,--end-group
+)
+set_property(TARGET ${PSA_TARGET_HOST_EXE} PROPERTY RUNTIME_OUTPUT_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR})
@@ -137,17 +137,26 @@ Done:
     return status;
 }
 
-uint32_t pal_compute_hash(int32_t cose_alg_id, struct q_useful_buf buffer_for_hash,
-                          struct q_useful_buf_c *hash, struct q_useful_buf_c protected_headers,
-                          struct q_useful_buf_c payload)
+/**
+    @brief    - This API will start the hash of the COSE Sig_structure of a token. The
+                payload is hashed afterwards with pal_cose_crypto_hash_update, possibly
+                in several parts, and the hash is completed with pal_cose_crypto_hash_finish.
+    @param    - psa_hash          : Hash operation
+                cose_alg_id       : COSE signature algorithm of the token
+                protected_headers : Protected headers of the token
+                payload_size      : Size of the payload in bytes
+    @return   - error status
+**/
+uint32_t pal_compute_hash_start(psa_hash_operation_t *psa_hash, int32_t cose_alg_id,
+                                struct q_useful_buf_c protected_headers, size_t payload_size)
 {
     uint32_t                    status;
     QCBOREncodeContext          cbor_encode_ctx;
     struct q_useful_buf_c       tbs_first_part;
+    struct q_useful_buf_c       payload = {NULL, payload_size};
     QCBORError                  qcbor_result;
     int32_t                     hash_alg_id;
     UsefulBuf_MAKE_STACK_UB    (buffer_for_TBS_first_part, T_COSE_SIZE_OF_TBS);
-    psa_hash_operation_t        psa_hash = PSA_HASH_OPERATION_INIT;
 
     /* This builds the CBOR-format to-be-signed bytes */
     QCBOREncode_Init(&cbor_encode_ctx, buffer_for_TBS_first_part);
@@ -163,7 +172,7 @@ uint32_t pal_compute_hash(int32_t cose_alg_id, struct q_useful_buf buffer_for_ha
     /* external_aad */
     QCBOREncode_AddBytes(&cbor_encode_ctx, NULL_USEFUL_BUF_C);
 
-    /* The short fake payload. */
+    /* The short fake payload, only its length is encoded */
     QCBOREncode_AddBytesLenOnly(&cbor_encode_ctx, payload);
     QCBOREncode_CloseArray(&cbor_encode_ctx);
 
@@ -174,8 +183,7 @@ uint32_t pal_compute_hash(int32_t cose_alg_id, struct q_useful_buf buffer_for_ha
         /* Mainly means that the protected_headers were too big
          * (which should never happen)
          */
-        status = PAL_ATTEST_ERR_SIGN_STRUCT;
-        goto Done;
+        return PAL_ATTEST_ERR_SIGN_STRUCT;
     }
 
     /* Start the hashing */
@@ -184,14 +192,28 @@ uint32_t pal_compute_hash(int32_t cose_alg_id, struct q_useful_buf buffer_for_ha
     /* Don't check hash_alg_id for failure. pal_cose_crypto_hash_start()
      * will handle it properly
      */
-    status = pal_cose_crypto_hash_start(&psa_hash, hash_alg_id);
+    status = pal_cose_crypto_hash_start(psa_hash, hash_alg_id);
     if (status)
-        goto Done;
+        return status;
 
     /* This is hashing of the first part, all the CBOR
      * except the payload.
      */
-    pal_cose_crypto_hash_update(&psa_hash, useful_buf_head(tbs_first_part, tbs_first_part.len));
+    pal_cose_crypto_hash_update(psa_hash, useful_buf_head(tbs_first_part, tbs_first_part.len));
+
+    return PAL_ATTEST_SUCCESS;
+}
+
+uint32_t pal_compute_hash(int32_t cose_alg_id, struct q_useful_buf buffer_for_hash,
+                          struct q_useful_buf_c *hash, struct q_useful_buf_c protected_headers,
+                          struct q_useful_buf_c payload)
+{
+    uint32_t                    status;
+    psa_hash_operation_t        psa_hash = PSA_HASH_OPERATION_INIT;
+
+    status = pal_compute_hash_start(&psa_hash, cose_alg_id, protected_headers, payload.len);
+    if (status)
+        goto Done;
 
     /* Hash the payload, the second part. */
     pal_cose_crypto_hash_update(&psa_hash, payload);
@@ -130,3 +130,41 @@ void pal_disable_interrupt(void)
 {
     pal_uart_cmsdk_disable_irq();
 }
+
+/* Set when the DWT cycle counter is not implemented and SysTick stands in for it */
+static uint32_t cycle_counter_systick;
+
+/**
+    @brief   - Enables the cycle counter of the CPU. SysTick is used if the DWT
+               cycle counter is not implemented, e.g. on Armv8-M Baseline.
+    @param   - freq_hz : Returns the counter frequency in Hz, 0 if not known
+    @return  - SUCCESS/FAILURE
+**/
+int pal_cycle_counter_init(uint32_t *freq_hz)
+{
+    if (pal_dwt_cycle_counter_init())
+    {
+        if (pal_systick_counter_init())
+        {
+            return PAL_STATUS_UNSUPPORTED_FUNC;
+        }
+        cycle_counter_systick = 1;
+    }
+
+    *freq_hz = PAL_CPU_CLOCK_HZ;
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief   - Reads the cycle counter of the CPU
+    @param   - void
+    @return  - Counter value, wraps around at 32 bits
+**/
+uint32_t pal_cycle_counter_read(void)
+{
+    if (cycle_counter_systick)
+    {
+        return pal_systick_counter_read();
+    }
+    return pal_dwt_cycle_counter_read();
+}
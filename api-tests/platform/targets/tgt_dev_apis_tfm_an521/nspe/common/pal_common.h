@@ -79,8 +79,18 @@ typedef struct {
 typedef enum {
     UART_INIT             = 0x1,
     UART_PRINT            = 0x2,
+    UART_PRINT_BATCH      = 0x3,
 } uart_fn_type_t;
 
+/* Size of the string buffer of the UART RoT service. Longer strings are truncated */
+#define PAL_PRINT_STRING_SIZE   256
+
+/* UART_PRINT_BATCH record header, followed by str_len bytes of NUL terminated string */
+typedef struct {
+    int32_t  data;
+    uint32_t str_len;
+} uart_print_rec_t;
+
 /*
  * Redefining some of the client.h elements for compilation to go through
  * when PSA IPC APIs are not implemented.
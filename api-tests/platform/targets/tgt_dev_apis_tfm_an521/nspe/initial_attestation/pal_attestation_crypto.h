@@ -79,6 +79,8 @@ int32_t pal_cose_crypto_hash_finish(psa_hash_operation_t *psa_hash,
                                     struct q_useful_buf_c *hash_result);
 int pal_create_sha256(struct q_useful_buf_c bytes_to_hash, struct q_useful_buf buffer_for_hash,
                       struct q_useful_buf_c *hash);
+uint32_t pal_compute_hash_start(psa_hash_operation_t *psa_hash, int32_t cose_alg_id,
+                                struct q_useful_buf_c protected_headers, size_t payload_size);
 uint32_t pal_compute_hash(int32_t cose_alg_id, struct q_useful_buf buffer_for_hash,
                           struct q_useful_buf_c *hash, struct q_useful_buf_c protected_headers,
                           struct q_useful_buf_c payload);
@@ -163,10 +163,54 @@ enum attestation_error_code {
     PAL_ATTEST_ERROR,
 };
 
-struct items_to_get_t {
-    int64_t label;
-    QCBORItem item;
-};
-
+/* Capacity of the claim index of the token payload. Each software component takes up
+ * to PAL_ATTEST_MAX_SW_COMPONENT_CLAIMS entries.
+ */
+#ifndef PAL_ATTEST_MAX_SW_COMPONENTS
+#define PAL_ATTEST_MAX_SW_COMPONENTS            16
+#endif
+#define PAL_ATTEST_MAX_SW_COMPONENT_CLAIMS      6
+#define PAL_ATTEST_MAX_TOP_LEVEL_CLAIMS         16
+#define PAL_ATTEST_MAX_CLAIMS                   (PAL_ATTEST_MAX_TOP_LEVEL_CLAIMS +            \
+                                                 PAL_ATTEST_MAX_SW_COMPONENTS *              \
+                                                 PAL_ATTEST_MAX_SW_COMPONENT_CLAIMS)
+#define PAL_ATTEST_MAX_HEADER_PARAMS            8
+
+/* Buffers of the streaming verification. The COSE_Sign1 headers up to the payload and
+ * the signature are buffered, the payload is not.
+ */
+#define PAL_ATTEST_STREAM_HEADERS_SIZE          128
+#define PAL_ATTEST_MAX_SIGNATURE_SIZE           (2 * T_COSE_CRYPTO_EC_P256_COORD_SIZE)
+#define PAL_ATTEST_STREAM_MAX_DEPTH             8
+
+/* Component number of the claims of the indexed map itself */
+#define PAL_ATTEST_TOP_LEVEL_CLAIM              0xFF
+
+/* Claim recorded by the index. Strings point into the decoded buffer. */
+typedef struct {
+    int64_t                 label;
+    union {
+        int64_t               int64;
+        struct q_useful_buf_c string;
+        uint16_t              count;   /* Number of items of a map or an array */
+    } val;
+    uint32_t                offset;    /* Offset of the claim in the decoded buffer */
+    uint8_t                 data_type; /* QCBOR_TYPE_xxx */
+    uint8_t                 component; /* SW component number or PAL_ATTEST_TOP_LEVEL_CLAIM */
+} pal_attest_claim_t;
+
+typedef struct {
+    pal_attest_claim_t     *claims;
+    uint32_t                capacity;
+    uint32_t                count;
+    uint32_t                sw_component_count;
+} pal_attest_claim_index_t;
+
+int32_t pal_attest_index_claims(struct q_useful_buf_c buffer, pal_attest_claim_index_t *index);
+const pal_attest_claim_t *pal_attest_find_claim(const pal_attest_claim_index_t *index,
+                                                int64_t label, uint8_t component);
 int32_t pal_initial_attest_verify_token(uint8_t *challenge, size_t challenge_size,
                                         uint8_t *token, size_t token_size);
+int32_t pal_initial_attest_verify_token_start(uint8_t *challenge, size_t challenge_size);
+int32_t pal_initial_attest_verify_token_update(uint8_t *chunk, size_t chunk_size);
+int32_t pal_initial_attest_verify_token_finish(void);
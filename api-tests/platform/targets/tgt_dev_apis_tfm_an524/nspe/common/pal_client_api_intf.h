@@ -29,4 +29,5 @@ psa_status_t pal_ipc_call(psa_handle_t handle,
                       psa_outvec *out_vec,
                       size_t out_len);
 void pal_ipc_close(psa_handle_t handle);
+int pal_print_flush_ns(void);
 #endif /* _PAL_CLIENT_API_H_ */
@@ -21,6 +21,8 @@
 #include "pal_uart.h"
 #include "pal_nvmem.h"
 #include "pal_wd_cmsdk.h"
+#include "pal_dwt.h"
+#include "pal_systick.h"
 
 void pal_uart_init(uint32_t uart_base_addr);
 void pal_print(char *str, int32_t data);
@@ -32,4 +34,6 @@ int pal_wd_timer_disable(addr_t base_addr);
 int pal_wd_timer_is_enabled(addr_t base_addr);
 void pal_generate_interrupt(void);
 void pal_disable_interrupt(void);
+int pal_cycle_counter_init(uint32_t *freq_hz);
+uint32_t pal_cycle_counter_read(void);
 #endif /* _PAL_DRIVER_INTF_H_ */
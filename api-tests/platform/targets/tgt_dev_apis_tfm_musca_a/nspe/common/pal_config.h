@@ -40,6 +40,9 @@
 #define SP_HEAP_MEM_SUPP
 #endif /* PSA_CMAKE_BUILD */
 
+/* CPU clock frequency, the rate of the cycle counter used by the performance suites */
+#define PAL_CPU_CLOCK_HZ            50000000
+
 /* Version of crypto spec used in attestation */
 #define CRYPTO_VERSION_BETA2
 
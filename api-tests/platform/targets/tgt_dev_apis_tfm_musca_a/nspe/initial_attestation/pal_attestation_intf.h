@@ -24,6 +24,9 @@ enum attestation_function_code {
     PAL_INITIAL_ATTEST_GET_TOKEN        = 0x1,
     PAL_INITIAL_ATTEST_GET_TOKEN_SIZE   = 0x2,
     PAL_INITIAL_ATTEST_VERIFY_TOKEN     = 0x3,
+    PAL_INITIAL_ATTEST_VERIFY_TOKEN_START  = 0x4,
+    PAL_INITIAL_ATTEST_VERIFY_TOKEN_UPDATE = 0x5,
+    PAL_INITIAL_ATTEST_VERIFY_TOKEN_FINISH = 0x6,
 };
 
 int32_t pal_attestation_function(int type, va_list valist);
@@ -29,12 +29,14 @@ list(APPEND PAL_SRC_ASM_DRIVER_SP )
 
 
 # Listing all the sources required for given target
-if(${SUITE} STREQUAL "IPC")
+if(${SUITE} IN_LIST PSA_SUITES_FF)
 	list(APPEND PAL_SRC_C_NSPE
 		# driver functionalities are implemented as RoT-services
 		# and secure and non-secure clients will call to these RoT-services to get appropriate driver services.
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/common/pal_client_api_intf.c
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/common/pal_driver_ipc_intf.c
+		${PSA_ROOT_DIR}/platform/drivers/cycle_counter/dwt/pal_dwt.c
+		${PSA_ROOT_DIR}/platform/drivers/cycle_counter/systick/pal_systick.c
 	)
 	list(APPEND PAL_SRC_C_DRIVER_SP
 		# Driver files will be compiled as part of driver partition
@@ -42,33 +44,37 @@ if(${SUITE} STREQUAL "IPC")
 		${PSA_ROOT_DIR}/platform/drivers/nvmem/pal_nvmem.c
 		${PSA_ROOT_DIR}/platform/drivers/uart/pl011/pal_uart.c
 		${PSA_ROOT_DIR}/platform/drivers/watchdog/cmsdk/pal_wd_cmsdk.c
+		${PSA_ROOT_DIR}/platform/drivers/cycle_counter/dwt/pal_dwt.c
+		${PSA_ROOT_DIR}/platform/drivers/cycle_counter/systick/pal_systick.c
 	)
 else()
 	list(APPEND PAL_SRC_C_NSPE
 		# driver files will be compiled as part of NSPE
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/common/pal_client_api_empty_intf.c
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/common/pal_driver_ns_intf.c
+		${PSA_ROOT_DIR}/platform/drivers/cycle_counter/dwt/pal_dwt.c
+		${PSA_ROOT_DIR}/platform/drivers/cycle_counter/systick/pal_systick.c
 		${PSA_ROOT_DIR}/platform/drivers/nvmem/pal_nvmem.c
 		${PSA_ROOT_DIR}/platform/drivers/uart/pl011/pal_uart.c
 		${PSA_ROOT_DIR}/platform/drivers/watchdog/cmsdk/pal_wd_cmsdk.c
 	)
 endif()
-if(${SUITE} STREQUAL "CRYPTO")
+if(("CRYPTO" IN_LIST PSA_SUITE_LIST) OR ("CRYPTO_PERF" IN_LIST PSA_SUITE_LIST))
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/crypto/pal_crypto_intf.c
 	)
 endif()
-if(${SUITE} STREQUAL "PROTECTED_STORAGE")
+if(("PROTECTED_STORAGE" IN_LIST PSA_SUITE_LIST) OR ("STORAGE_PERF" IN_LIST PSA_SUITE_LIST))
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/protected_storage/pal_protected_storage_intf.c
 	)
 endif()
-if(${SUITE} STREQUAL "INTERNAL_TRUSTED_STORAGE")
+if(("INTERNAL_TRUSTED_STORAGE" IN_LIST PSA_SUITE_LIST) OR ("STORAGE_PERF" IN_LIST PSA_SUITE_LIST))
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/internal_trusted_storage/pal_internal_trusted_storage_intf.c
 	)
 endif()
-if(${SUITE} STREQUAL "INITIAL_ATTESTATION")
+if("INITIAL_ATTESTATION" IN_LIST PSA_SUITE_LIST)
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/initial_attestation/pal_attestation_intf.c
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/initial_attestation/pal_attestation_eat.c
@@ -86,6 +92,8 @@ endforeach()
 
 list(APPEND PAL_DRIVER_INCLUDE_PATHS
 	${PSA_ROOT_DIR}/platform/drivers/nvmem
+	${PSA_ROOT_DIR}/platform/drivers/cycle_counter/dwt
+	${PSA_ROOT_DIR}/platform/drivers/cycle_counter/systick
 	${PSA_ROOT_DIR}/platform/drivers/uart/pl011
 	${PSA_ROOT_DIR}/platform/drivers/watchdog/cmsdk
 )
@@ -99,7 +107,7 @@ target_include_directories(${PSA_TARGET_PAL_NSPE_LIB} PRIVATE
 	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/initial_attestation
 )
 
-if(${SUITE} STREQUAL "INITIAL_ATTESTATION")
+if("INITIAL_ATTESTATION" IN_LIST PSA_SUITE_LIST)
 target_include_directories(${PSA_TARGET_PAL_NSPE_LIB} PRIVATE
 	${PSA_QCBOR_INCLUDE_PATH}
 )
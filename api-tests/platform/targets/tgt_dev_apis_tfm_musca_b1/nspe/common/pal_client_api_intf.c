@@ -56,6 +56,8 @@ uint32_t pal_ipc_version(uint32_t sid)
 
 psa_handle_t pal_ipc_connect(uint32_t sid, uint32_t minor_version)
 {
+    /* Keep pending non-secure prints ordered with the prints of the RoT service */
+    pal_print_flush_ns();
     return (psa_connect(sid, minor_version));
 }
 
@@ -79,6 +81,7 @@ psa_status_t pal_ipc_call(psa_handle_t handle,
                          psa_outvec *out_vec,
                          size_t out_len)
 {
+    pal_print_flush_ns();
     return (psa_call(handle, in_vec, in_len, out_vec, out_len));
 }
 
@@ -93,5 +96,6 @@ psa_status_t pal_ipc_call(psa_handle_t handle,
 
 void pal_ipc_close(psa_handle_t handle)
 {
+    pal_print_flush_ns();
     psa_close(handle);
 }
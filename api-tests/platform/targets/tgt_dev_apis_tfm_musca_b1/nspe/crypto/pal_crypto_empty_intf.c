@@ -16,7 +16,7 @@
 **/
 
 #include <stdarg.h>
-#include "pal_common.h"
+#include "pal_crypto_intf.h"
 
 /**
     @brief    - This API will call the requested crypto function
@@ -28,3 +28,13 @@ int32_t pal_crypto_function(int type, va_list valist)
 {
     return PAL_STATUS_ERROR;
 }
+
+/**
+    @brief    - This API returns the table of direct crypto entry points
+    @param    - void
+    @return   - NULL, crypto is not supported
+**/
+const pal_crypto_ops_t *pal_crypto_get_ops(void)
+{
+    return NULL;
+}
@@ -20,7 +20,7 @@
 
 #include "pal_common.h"
 
-enum crypto_function_code {
+enum pal_crypto_function_code {
     PAL_CRYPTO_INIT                             = 0x1,
     PAL_CRYPTO_GENERATE_RANDOM                  = 0x2,
     PAL_CRYPTO_IMPORT_KEY                       = 0x3,
@@ -99,5 +99,176 @@ enum crypto_function_code {
     PAL_CRYPTO_FREE                             = 0xFE,
 };
 
+typedef struct pal_crypto_ops_s pal_crypto_ops_t;
+
+#ifdef CRYPTO
+/* Entry points of the PSA Crypto implementation. Each member takes the arguments of
+ * the psa_* function of the same name, so that callers skip the va_list decoding of
+ * pal_crypto_function. The key attribute accessors may be implemented as macros or
+ * inline functions and are only available through pal_crypto_function.
+ */
+struct pal_crypto_ops_s {
+    psa_status_t (*crypto_init)(void);
+    psa_status_t (*generate_random)(uint8_t *output, size_t output_size);
+    psa_status_t (*import_key)(const psa_key_attributes_t *attributes, const uint8_t *data,
+                               size_t data_length, psa_key_handle_t *handle);
+    psa_status_t (*generate_key)(const psa_key_attributes_t *attributes,
+                                 psa_key_handle_t *handle);
+    psa_status_t (*copy_key)(psa_key_handle_t source_handle,
+                             const psa_key_attributes_t *attributes,
+                             psa_key_handle_t *target_handle);
+    psa_status_t (*export_key)(psa_key_handle_t handle, uint8_t *data, size_t data_size,
+                               size_t *data_length);
+    psa_status_t (*export_public_key)(psa_key_handle_t handle, uint8_t *data,
+                                      size_t data_size, size_t *data_length);
+    psa_status_t (*get_key_attributes)(psa_key_handle_t handle,
+                                       psa_key_attributes_t *attributes);
+    psa_status_t (*open_key)(psa_key_id_t id, psa_key_handle_t *handle);
+    psa_status_t (*close_key)(psa_key_handle_t handle);
+    psa_status_t (*destroy_key)(psa_key_handle_t handle);
+
+    psa_status_t (*hash_compute)(psa_algorithm_t alg, const uint8_t *input,
+                                 size_t input_length, uint8_t *hash, size_t hash_size,
+                                 size_t *hash_length);
+    psa_status_t (*hash_compare)(psa_algorithm_t alg, const uint8_t *input,
+                                 size_t input_length, const uint8_t *hash,
+                                 size_t hash_length);
+    psa_status_t (*hash_setup)(psa_hash_operation_t *operation, psa_algorithm_t alg);
+    psa_status_t (*hash_update)(psa_hash_operation_t *operation, const uint8_t *input,
+                                size_t input_length);
+    psa_status_t (*hash_finish)(psa_hash_operation_t *operation, uint8_t *hash,
+                                size_t hash_size, size_t *hash_length);
+    psa_status_t (*hash_verify)(psa_hash_operation_t *operation, const uint8_t *hash,
+                                size_t hash_length);
+    psa_status_t (*hash_abort)(psa_hash_operation_t *operation);
+    psa_status_t (*hash_clone)(const psa_hash_operation_t *source_operation,
+                               psa_hash_operation_t *target_operation);
+
+    psa_status_t (*mac_compute)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                const uint8_t *input, size_t input_length, uint8_t *mac,
+                                size_t mac_size, size_t *mac_length);
+    psa_status_t (*mac_verify)(psa_key_handle_t handle, psa_algorithm_t alg,
+                               const uint8_t *input, size_t input_length, const uint8_t *mac,
+                               size_t mac_length);
+    psa_status_t (*mac_sign_setup)(psa_mac_operation_t *operation, psa_key_handle_t handle,
+                                   psa_algorithm_t alg);
+    psa_status_t (*mac_verify_setup)(psa_mac_operation_t *operation, psa_key_handle_t handle,
+                                     psa_algorithm_t alg);
+    psa_status_t (*mac_update)(psa_mac_operation_t *operation, const uint8_t *input,
+                               size_t input_length);
+    psa_status_t (*mac_sign_finish)(psa_mac_operation_t *operation, uint8_t *mac,
+                                    size_t mac_size, size_t *mac_length);
+    psa_status_t (*mac_verify_finish)(psa_mac_operation_t *operation, const uint8_t *mac,
+                                      size_t mac_length);
+    psa_status_t (*mac_abort)(psa_mac_operation_t *operation);
+
+    psa_status_t (*cipher_encrypt)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                   const uint8_t *input, size_t input_length,
+                                   uint8_t *output, size_t output_size,
+                                   size_t *output_length);
+    psa_status_t (*cipher_decrypt)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                   const uint8_t *input, size_t input_length,
+                                   uint8_t *output, size_t output_size,
+                                   size_t *output_length);
+    psa_status_t (*cipher_encrypt_setup)(psa_cipher_operation_t *operation,
+                                         psa_key_handle_t handle, psa_algorithm_t alg);
+    psa_status_t (*cipher_decrypt_setup)(psa_cipher_operation_t *operation,
+                                         psa_key_handle_t handle, psa_algorithm_t alg);
+    psa_status_t (*cipher_generate_iv)(psa_cipher_operation_t *operation, uint8_t *iv,
+                                       size_t iv_size, size_t *iv_length);
+    psa_status_t (*cipher_set_iv)(psa_cipher_operation_t *operation, const uint8_t *iv,
+                                  size_t iv_length);
+    psa_status_t (*cipher_update)(psa_cipher_operation_t *operation, const uint8_t *input,
+                                  size_t input_length, uint8_t *output, size_t output_size,
+                                  size_t *output_length);
+    psa_status_t (*cipher_finish)(psa_cipher_operation_t *operation, uint8_t *output,
+                                  size_t output_size, size_t *output_length);
+    psa_status_t (*cipher_abort)(psa_cipher_operation_t *operation);
+
+    psa_status_t (*aead_encrypt)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                 const uint8_t *nonce, size_t nonce_length,
+                                 const uint8_t *additional_data,
+                                 size_t additional_data_length, const uint8_t *plaintext,
+                                 size_t plaintext_length, uint8_t *ciphertext,
+                                 size_t ciphertext_size, size_t *ciphertext_length);
+    psa_status_t (*aead_decrypt)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                 const uint8_t *nonce, size_t nonce_length,
+                                 const uint8_t *additional_data,
+                                 size_t additional_data_length, const uint8_t *ciphertext,
+                                 size_t ciphertext_length, uint8_t *plaintext,
+                                 size_t plaintext_size, size_t *plaintext_length);
+    psa_status_t (*aead_encrypt_setup)(psa_aead_operation_t *operation,
+                                       psa_key_handle_t handle, psa_algorithm_t alg);
+    psa_status_t (*aead_decrypt_setup)(psa_aead_operation_t *operation,
+                                       psa_key_handle_t handle, psa_algorithm_t alg);
+    psa_status_t (*aead_generate_nonce)(psa_aead_operation_t *operation, uint8_t *nonce,
+                                        size_t nonce_size, size_t *nonce_length);
+    psa_status_t (*aead_set_nonce)(psa_aead_operation_t *operation, const uint8_t *nonce,
+                                   size_t nonce_length);
+    psa_status_t (*aead_set_lengths)(psa_aead_operation_t *operation, size_t ad_length,
+                                     size_t plaintext_length);
+    psa_status_t (*aead_update_ad)(psa_aead_operation_t *operation, const uint8_t *input,
+                                   size_t input_length);
+    psa_status_t (*aead_update)(psa_aead_operation_t *operation, const uint8_t *input,
+                                size_t input_length, uint8_t *output, size_t output_size,
+                                size_t *output_length);
+    psa_status_t (*aead_finish)(psa_aead_operation_t *operation, uint8_t *ciphertext,
+                                size_t ciphertext_size, size_t *ciphertext_length,
+                                uint8_t *tag, size_t tag_size, size_t *tag_length);
+    psa_status_t (*aead_verify)(psa_aead_operation_t *operation, uint8_t *plaintext,
+                                size_t plaintext_size, size_t *plaintext_length,
+                                const uint8_t *tag, size_t tag_length);
+    psa_status_t (*aead_abort)(psa_aead_operation_t *operation);
+
+    psa_status_t (*asymmetric_sign)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                    const uint8_t *hash, size_t hash_length,
+                                    uint8_t *signature, size_t signature_size,
+                                    size_t *signature_length);
+    psa_status_t (*asymmetric_verify)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                      const uint8_t *hash, size_t hash_length,
+                                      const uint8_t *signature, size_t signature_length);
+    psa_status_t (*asymmetric_encrypt)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                       const uint8_t *input, size_t input_length,
+                                       const uint8_t *salt, size_t salt_length,
+                                       uint8_t *output, size_t output_size,
+                                       size_t *output_length);
+    psa_status_t (*asymmetric_decrypt)(psa_key_handle_t handle, psa_algorithm_t alg,
+                                       const uint8_t *input, size_t input_length,
+                                       const uint8_t *salt, size_t salt_length,
+                                       uint8_t *output, size_t output_size,
+                                       size_t *output_length);
+
+    psa_status_t (*key_derivation_setup)(psa_key_derivation_operation_t *operation,
+                                         psa_algorithm_t alg);
+    psa_status_t (*key_derivation_input_bytes)(psa_key_derivation_operation_t *operation,
+                                               psa_key_derivation_step_t step,
+                                               const uint8_t *data, size_t data_length);
+    psa_status_t (*key_derivation_input_key)(psa_key_derivation_operation_t *operation,
+                                             psa_key_derivation_step_t step,
+                                             psa_key_handle_t handle);
+    psa_status_t (*key_derivation_key_agreement)(psa_key_derivation_operation_t *operation,
+                                                 psa_key_derivation_step_t step,
+                                                 psa_key_handle_t private_key,
+                                                 const uint8_t *peer_key,
+                                                 size_t peer_key_length);
+    psa_status_t (*key_derivation_set_capacity)(psa_key_derivation_operation_t *operation,
+                                                size_t capacity);
+    psa_status_t (*key_derivation_get_capacity)(
+                                          const psa_key_derivation_operation_t *operation,
+                                          size_t *capacity);
+    psa_status_t (*key_derivation_output_bytes)(psa_key_derivation_operation_t *operation,
+                                                uint8_t *output, size_t output_length);
+    psa_status_t (*key_derivation_output_key)(const psa_key_attributes_t *attributes,
+                                              psa_key_derivation_operation_t *operation,
+                                              psa_key_handle_t *handle);
+    psa_status_t (*key_derivation_abort)(psa_key_derivation_operation_t *operation);
+    psa_status_t (*raw_key_agreement)(psa_algorithm_t alg, psa_key_handle_t private_key,
+                                      const uint8_t *peer_key, size_t peer_key_length,
+                                      uint8_t *output, size_t output_size,
+                                      size_t *output_length);
+};
+#endif
+
 int32_t pal_crypto_function(int type, va_list valist);
+const pal_crypto_ops_t *pal_crypto_get_ops(void);
 #endif /* _PAL_CRYPTO_H_ */
@@ -50,6 +50,16 @@ int32_t pal_attestation_function(int type, va_list valist)
             verify_token_size = va_arg(valist, size_t);
             return pal_initial_attest_verify_token(challenge, challenge_size,
                                                    token, verify_token_size);
+        case PAL_INITIAL_ATTEST_VERIFY_TOKEN_START:
+            challenge = va_arg(valist, uint8_t*);
+            challenge_size = va_arg(valist, size_t);
+            return pal_initial_attest_verify_token_start(challenge, challenge_size);
+        case PAL_INITIAL_ATTEST_VERIFY_TOKEN_UPDATE:
+            token = va_arg(valist, uint8_t*);
+            verify_token_size = va_arg(valist, size_t);
+            return pal_initial_attest_verify_token_update(token, verify_token_size);
+        case PAL_INITIAL_ATTEST_VERIFY_TOKEN_FINISH:
+            return pal_initial_attest_verify_token_finish();
         default:
             return PAL_STATUS_UNSUPPORTED_FUNC;
     }
@@ -17,15 +17,33 @@
 
 #include "pal_common.h"
 #include "pal_client_api_intf.h"
+#include "pal_dwt.h"
+#include "pal_systick.h"
+
+/* Size of the non-secure print batch. A batch is sent to the driver partition
+ * as a single UART_PRINT_BATCH call when it fills up or is flushed, and holds the
+ * prints of a typical test. The driver partition reads it record by record, so
+ * only this buffer grows with it. Set with -DPAL_PRINT_BATCH_SIZE=<bytes>. */
+#ifndef PAL_PRINT_BATCH_SIZE
+#define PAL_PRINT_BATCH_SIZE    2048
+#endif
+
+#if (PAL_PRINT_BATCH_SIZE < (PAL_PRINT_STRING_SIZE + 8))
+#error "PAL_PRINT_BATCH_SIZE must hold a record of PAL_PRINT_STRING_SIZE"
+#endif
+
+static psa_handle_t     print_handle = PSA_NULL_HANDLE;
+static uint8_t          print_batch[PAL_PRINT_BATCH_SIZE];
+static uint32_t         print_batch_len;
 
 /**
-    @brief    - This function initializes the UART
+    @brief    - This function initializes the UART. The connection to the UART RoT
+                service is kept open and reused by subsequent print requests.
     @param    - uart base addr
     @return   - SUCCESS/FAILURE
 **/
 int pal_uart_init_ns(uint32_t uart_base_addr)
 {
-    psa_handle_t            print_handle = 0;
     psa_status_t            status_of_call = PSA_SUCCESS;
     uart_fn_type_t          uart_fn = UART_INIT;
 
@@ -33,24 +51,94 @@ int pal_uart_init_ns(uint32_t uart_base_addr)
                          {&uart_base_addr, sizeof(uart_base_addr)},
                          {NULL, 0}};
 
-    print_handle = pal_ipc_connect(DRIVER_UART_SID, 0);
-    if (print_handle < 0)
+    if (print_handle <= 0)
     {
-        return(PAL_STATUS_ERROR);
+        print_handle = psa_connect(DRIVER_UART_SID, 0);
+        if (print_handle < 0)
+        {
+            return(PAL_STATUS_ERROR);
+        }
     }
 
-    status_of_call = pal_ipc_call(print_handle, data, 3, NULL, 0);
+    print_batch_len = 0;
+    status_of_call = psa_call(print_handle, data, 3, NULL, 0);
     if (status_of_call != PSA_SUCCESS)
     {
         return(PAL_STATUS_ERROR);
     }
 
-    pal_ipc_close(print_handle);
     return PAL_STATUS_SUCCESS;
 }
 
 /**
-    @brief    - This function parses the input string and writes bytes into UART TX FIFO
+    @brief    - Sends the pending print records to the UART RoT service
+    @param    - void
+    @return   - SUCCESS/FAILURE
+**/
+int pal_print_flush_ns(void)
+{
+    psa_status_t    status_of_call = PSA_SUCCESS;
+    uart_fn_type_t  uart_fn = UART_PRINT_BATCH;
+
+    psa_invec data[3] = {{&uart_fn, sizeof(uart_fn)},
+                         {print_batch, print_batch_len},
+                         {NULL, 0}};
+
+    if ((print_batch_len == 0) || (print_handle <= 0))
+    {
+        return PAL_STATUS_SUCCESS;
+    }
+
+    status_of_call = psa_call(print_handle, data, 3, NULL, 0);
+    print_batch_len = 0;
+    if (status_of_call != PSA_SUCCESS)
+    {
+        return PAL_STATUS_ERROR;
+    }
+
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Writes raw bytes to the UART, used by the binary log mode. Not
+                supported when the UART is driven by the driver partition.
+    @param    - data     : Bytes to write
+              - size     : Number of bytes
+    @return   - PAL_STATUS_UNSUPPORTED_FUNC
+**/
+int pal_uart_write_ns(uint8_t *data, uint32_t size)
+{
+    (void)data;
+    (void)size;
+    return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+/**
+    @brief    - Switches the UART to the interrupt driven TX mode. Not supported,
+                the prints are sent through the driver partition.
+    @param    - intr_id  : Interrupt number of the UART TX interrupt
+    @return   - PAL_STATUS_UNSUPPORTED_FUNC
+**/
+int pal_uart_tx_irq_init_ns(uint32_t intr_id)
+{
+    (void)intr_id;
+    return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+/**
+    @brief    - UART TX interrupt handler of the interrupt driven TX mode
+    @param    - void
+    @return   - void
+**/
+void pal_uart_tx_irq_handler_ns(void)
+{
+}
+
+/**
+    @brief    - This function parses the input string and writes bytes into UART TX FIFO.
+                The string is queued in the print batch and sent to the UART RoT service
+                when the batch is full or flushed. Strings longer than the buffer of the
+                service, PAL_PRINT_STRING_SIZE with the NUL, are truncated.
     @param    - str      : Input String
               - data     : Value for format specifier
     @return   - SUCCESS/FAILURE
@@ -58,38 +146,35 @@ int pal_uart_init_ns(uint32_t uart_base_addr)
 
 int pal_print_ns(char *str, int32_t data)
 {
-    int             string_len = 0;
-    char            *p = str;
-    psa_handle_t    print_handle = 0;
-    psa_status_t    status_of_call = PSA_SUCCESS;
-    pal_status_t    status = PAL_STATUS_SUCCESS;
-    uart_fn_type_t  uart_fn = UART_PRINT;
+    uart_print_rec_t    rec;
 
-    while (*p != '\0')
+    if (print_handle <= 0)
     {
-        string_len++;
-        p++;
+        return PAL_STATUS_ERROR;
     }
 
-    psa_invec data1[3] = {{&uart_fn, sizeof(uart_fn)},
-                          {str, string_len+1},
-                          {&data, sizeof(data)}};
-    print_handle = pal_ipc_connect(DRIVER_UART_SID, 0);
-
-    if (print_handle < 0)
+    rec.data = data;
+    rec.str_len = strlen(str) + 1;
+    if (rec.str_len > PAL_PRINT_STRING_SIZE)
     {
-        return PAL_STATUS_ERROR;
+        rec.str_len = PAL_PRINT_STRING_SIZE;
     }
-    else
+
+    if ((print_batch_len + sizeof(rec) + rec.str_len) > PAL_PRINT_BATCH_SIZE)
     {
-        status_of_call = pal_ipc_call(print_handle, data1, 3, NULL, 0);
-        if (status_of_call != PSA_SUCCESS)
+        if (pal_print_flush_ns() != PAL_STATUS_SUCCESS)
         {
-            status = PAL_STATUS_ERROR;
+            return PAL_STATUS_ERROR;
         }
     }
-    pal_ipc_close(print_handle);
-    return status;
+
+    memcpy(&print_batch[print_batch_len], &rec, sizeof(rec));
+    print_batch_len += sizeof(rec);
+    memcpy(&print_batch[print_batch_len], str, rec.str_len - 1);
+    print_batch_len += rec.str_len;
+    print_batch[print_batch_len - 1] = '\0';
+
+    return PAL_STATUS_SUCCESS;
 }
 
 /**
@@ -288,6 +373,57 @@ int pal_spi_read(addr_t addr, uint8_t *data, uint32_t len)
     return 0xFF;
 }
 
+/* Set when the DWT cycle counter is not implemented and SysTick stands in for it */
+static uint32_t cycle_counter_systick;
+
+/**
+ *   @brief    - Enables the cycle counter of the CPU. SysTick is used if the DWT
+ *               cycle counter is not implemented, e.g. on Armv8-M Baseline. SysTick
+ *               only counts correctly if read at least once per 2^24 cycles, so no
+ *               rate is reported for it and it is not used for long intervals.
+ *   @param    - freq_hz : Returns the counter frequency in Hz, 0 if not known
+ *   @return   - SUCCESS/FAILURE
+**/
+int pal_cycle_counter_init_ns(uint32_t *freq_hz)
+{
+    if (pal_dwt_cycle_counter_init())
+    {
+        if (pal_systick_counter_init())
+        {
+            return PAL_STATUS_UNSUPPORTED_FUNC;
+        }
+        cycle_counter_systick = 1;
+    }
+
+    *freq_hz = cycle_counter_systick ? 0 : PAL_CPU_CLOCK_HZ;
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+ *   @brief    - Reads the cycle counter of the CPU
+ *   @param    - void
+ *   @return   - Counter value, wraps around at 32 bits
+**/
+uint32_t pal_cycle_counter_read_ns(void)
+{
+    if (cycle_counter_systick)
+    {
+        return pal_systick_counter_read();
+    }
+    return pal_dwt_cycle_counter_read();
+}
+
+/**
+ *   @brief    - Checks whether the given test is selected to run. All the tests of
+ *               the suite are run on this platform.
+ *   @param    - test_id : Test ID
+ *   @return   - 1 if the test must run, 0 otherwise
+**/
+int pal_test_select_ns(uint32_t test_id)
+{
+    return 1;
+}
+
 /**
  *   @brief    - Terminates the simulation at the end of all tests completion.
  *               By default, it put cpus into power down mode.
@@ -19,6 +19,20 @@
 #include "pal_uart.h"
 #include "pal_nvmem.h"
 #include "pal_wd_cmsdk.h"
+#include "pal_dwt.h"
+#include "pal_systick.h"
+
+#ifdef CONCURRENCY_STRESS_THREADS
+#include "cmsis_os2.h"
+#include "mbed_rtos_storage.h"
+
+/* Threads of pal_thread_run_ns */
+#define PAL_THREAD_MAX                  8
+#define PAL_THREAD_STACK_SIZE           2048
+
+static mbed_rtos_storage_thread_t thread_cb[PAL_THREAD_MAX];
+static uint64_t thread_stack[PAL_THREAD_MAX][PAL_THREAD_STACK_SIZE / sizeof(uint64_t)];
+#endif
 
 /**
     @brief    - This function initializes the UART
@@ -44,6 +58,52 @@ int pal_print_ns(char *str, int32_t data)
     return PAL_STATUS_SUCCESS;
 }
 
+/**
+    @brief    - Waits until the prints queued in the interrupt driven TX mode are
+                written to the UART
+    @param    - void
+    @return   - SUCCESS/FAILURE
+**/
+int pal_print_flush_ns(void)
+{
+    pal_uart_cmsdk_flush();
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Writes raw bytes into UART TX FIFO, used by the binary log mode
+    @param    - data     : Bytes to write
+              - size     : Number of bytes
+    @return   - SUCCESS/FAILURE
+**/
+int pal_uart_write_ns(uint8_t *data, uint32_t size)
+{
+    pal_uart_cmsdk_write(data, size);
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Switches the UART to the interrupt driven TX mode, where the prints
+                are queued and sent from the UART TX interrupt
+    @param    - intr_id  : Interrupt number of the UART TX interrupt
+    @return   - SUCCESS/FAILURE
+**/
+int pal_uart_tx_irq_init_ns(uint32_t intr_id)
+{
+    pal_uart_cmsdk_tx_irq_init(intr_id);
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - UART TX interrupt handler of the interrupt driven TX mode
+    @param    - void
+    @return   - void
+**/
+void pal_uart_tx_irq_handler_ns(void)
+{
+    pal_uart_cmsdk_tx_irq_handler();
+}
+
 /**
     @brief           - Initializes an hardware watchdog timer
     @param           - base_addr       : Base address of the watchdog module
@@ -128,6 +188,106 @@ int pal_spi_read(addr_t addr, uint8_t *data, uint32_t len)
     return 0xFF;
 }
 
+/* Set when the DWT cycle counter is not implemented and SysTick stands in for it */
+static uint32_t cycle_counter_systick;
+
+/**
+ *   @brief    - Enables the cycle counter of the CPU. SysTick is used if the DWT
+ *               cycle counter is not implemented, e.g. on Armv8-M Baseline. SysTick
+ *               only counts correctly if read at least once per 2^24 cycles, so no
+ *               rate is reported for it and it is not used for long intervals.
+ *   @param    - freq_hz : Returns the counter frequency in Hz, 0 if not known
+ *   @return   - SUCCESS/FAILURE
+**/
+int pal_cycle_counter_init_ns(uint32_t *freq_hz)
+{
+    if (pal_dwt_cycle_counter_init())
+    {
+        if (pal_systick_counter_init())
+        {
+            return PAL_STATUS_UNSUPPORTED_FUNC;
+        }
+        cycle_counter_systick = 1;
+    }
+
+    *freq_hz = cycle_counter_systick ? 0 : PAL_CPU_CLOCK_HZ;
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+ *   @brief    - Reads the cycle counter of the CPU
+ *   @param    - void
+ *   @return   - Counter value, wraps around at 32 bits
+**/
+uint32_t pal_cycle_counter_read_ns(void)
+{
+    if (cycle_counter_systick)
+    {
+        return pal_systick_counter_read();
+    }
+    return pal_dwt_cycle_counter_read();
+}
+
+/**
+ *   @brief    - Checks whether the given test is selected to run. All the tests of
+ *               the suite are run on this platform.
+ *   @param    - test_id : Test ID
+ *   @return   - 1 if the test must run, 0 otherwise
+**/
+int pal_test_select_ns(uint32_t test_id)
+{
+    return 1;
+}
+
+/**
+ *   @brief    - Runs a function on several RTOS threads at once and waits for all of them
+ *               to end. The threads are only built with -DCONCURRENCY_STRESS_THREADS=<n>,
+ *               which needs the CMSIS-RTOS2 headers of Mbed OS in the include paths.
+ *   @param    - fn    : Function run by each thread
+ *               args  : Argument of each thread
+ *               count : Number of threads
+ *   @return   - SUCCESS/FAILURE. PAL_STATUS_UNSUPPORTED_FUNC if built without threads.
+**/
+int pal_thread_run_ns(void (*fn)(void *arg), void **args, uint32_t count)
+{
+#ifdef CONCURRENCY_STRESS_THREADS
+    osThreadAttr_t  attr = {0};
+    osThreadId_t    ids[PAL_THREAD_MAX];
+    uint32_t        i, started;
+    int             status = PAL_STATUS_SUCCESS;
+
+    if (count > PAL_THREAD_MAX)
+    {
+        return PAL_STATUS_ERROR;
+    }
+
+    for (started = 0; started < count; started++)
+    {
+        attr.name = "psa_stress";
+        attr.attr_bits = osThreadJoinable;
+        attr.cb_mem = &thread_cb[started];
+        attr.cb_size = sizeof(thread_cb[started]);
+        attr.stack_mem = thread_stack[started];
+        attr.stack_size = sizeof(thread_stack[started]);
+        attr.priority = osPriorityNormal;
+        ids[started] = osThreadNew((osThreadFunc_t)fn, args[started], &attr);
+        if (ids[started] == NULL)
+        {
+            status = PAL_STATUS_ERROR;
+            break;
+        }
+    }
+
+    for (i = 0; i < started; i++)
+    {
+        osThreadJoin(ids[i]);
+    }
+    return status;
+#else
+    return PAL_STATUS_UNSUPPORTED_FUNC;
+#endif
+}
+
 /**
  *   @brief    - Terminates the simulation at the end of all tests completion.
  *               By default, it put cpus into power down mode.
@@ -504,3 +504,78 @@ int32_t pal_crypto_function(int type, va_list valist)
             return PAL_STATUS_UNSUPPORTED_FUNC;
     }
 }
+
+static const pal_crypto_ops_t pal_crypto_ops = {
+    .crypto_init                  = psa_crypto_init,
+    .generate_random              = psa_generate_random,
+    .import_key                   = psa_import_key,
+    .generate_key                 = psa_generate_key,
+    .copy_key                     = psa_copy_key,
+    .export_key                   = psa_export_key,
+    .export_public_key            = psa_export_public_key,
+    .get_key_attributes           = psa_get_key_attributes,
+    .open_key                     = psa_open_key,
+    .close_key                    = psa_close_key,
+    .destroy_key                  = psa_destroy_key,
+    .hash_compute                 = psa_hash_compute,
+    .hash_compare                 = psa_hash_compare,
+    .hash_setup                   = psa_hash_setup,
+    .hash_update                  = psa_hash_update,
+    .hash_finish                  = psa_hash_finish,
+    .hash_verify                  = psa_hash_verify,
+    .hash_abort                   = psa_hash_abort,
+    .hash_clone                   = psa_hash_clone,
+    .mac_compute                  = psa_mac_compute,
+    .mac_verify                   = psa_mac_verify,
+    .mac_sign_setup               = psa_mac_sign_setup,
+    .mac_verify_setup             = psa_mac_verify_setup,
+    .mac_update                   = psa_mac_update,
+    .mac_sign_finish              = psa_mac_sign_finish,
+    .mac_verify_finish            = psa_mac_verify_finish,
+    .mac_abort                    = psa_mac_abort,
+    .cipher_encrypt               = psa_cipher_encrypt,
+    .cipher_decrypt               = psa_cipher_decrypt,
+    .cipher_encrypt_setup         = psa_cipher_encrypt_setup,
+    .cipher_decrypt_setup         = psa_cipher_decrypt_setup,
+    .cipher_generate_iv           = psa_cipher_generate_iv,
+    .cipher_set_iv                = psa_cipher_set_iv,
+    .cipher_update                = psa_cipher_update,
+    .cipher_finish                = psa_cipher_finish,
+    .cipher_abort                 = psa_cipher_abort,
+    .aead_encrypt                 = psa_aead_encrypt,
+    .aead_decrypt                 = psa_aead_decrypt,
+    .aead_encrypt_setup           = psa_aead_encrypt_setup,
+    .aead_decrypt_setup           = psa_aead_decrypt_setup,
+    .aead_generate_nonce          = psa_aead_generate_nonce,
+    .aead_set_nonce               = psa_aead_set_nonce,
+    .aead_set_lengths             = psa_aead_set_lengths,
+    .aead_update_ad               = psa_aead_update_ad,
+    .aead_update                  = psa_aead_update,
+    .aead_finish                  = psa_aead_finish,
+    .aead_verify                  = psa_aead_verify,
+    .aead_abort                   = psa_aead_abort,
+    .asymmetric_sign              = psa_asymmetric_sign,
+    .asymmetric_verify            = psa_asymmetric_verify,
+    .asymmetric_encrypt           = psa_asymmetric_encrypt,
+    .asymmetric_decrypt           = psa_asymmetric_decrypt,
+    .key_derivation_setup         = psa_key_derivation_setup,
+    .key_derivation_input_bytes   = psa_key_derivation_input_bytes,
+    .key_derivation_input_key     = psa_key_derivation_input_key,
+    .key_derivation_key_agreement = psa_key_derivation_key_agreement,
+    .key_derivation_set_capacity  = psa_key_derivation_set_capacity,
+    .key_derivation_get_capacity  = psa_key_derivation_get_capacity,
+    .key_derivation_output_bytes  = psa_key_derivation_output_bytes,
+    .key_derivation_output_key    = psa_key_derivation_output_key,
+    .key_derivation_abort         = psa_key_derivation_abort,
+    .raw_key_agreement            = psa_raw_key_agreement,
+};
+
+/**
+    @brief    - This API returns the table of direct crypto entry points
+    @param    - void
+    @return   - Pointer to the table
+**/
+const pal_crypto_ops_t *pal_crypto_get_ops(void)
+{
+    return &pal_crypto_ops;
+}
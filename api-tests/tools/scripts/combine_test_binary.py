@@ -0,0 +1,80 @@
+#!/usr/bin/python
+#/** @file
+# * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+import sys
+import struct
+import zlib
+
+if (len(sys.argv) < 3):
+	print("\nScript requires following inputs")
+	print("\narg1  : <OUTPUT combine_test_binary file>")
+	print("\narg2..: <INPUT  test_id:test ELF file> for each test")
+	sys.exit(1)
+
+out_binary = sys.argv[1]
+test_elfs  = sys.argv[2:]
+
+# Keep in sync with val/nspe/val_dispatcher.h
+VAL_TEST_START_MARKER = 0xfaceface
+VAL_TEST_END_MARKER   = 0xc3c3c3c3
+VAL_TEST_DIR_MARKER   = 0xd1ec7047
+VAL_TEST_DIR_VERSION  = 1
+
+DIR_HEADER_SIZE  = 16
+DIR_ENTRY_SIZE   = 16
+TEST_HEADER_SIZE = 12
+
+def read_tests():
+	"""
+	Parse test_id:elf arguments and return the list of tests sorted by test_id
+	"""
+	tests = []
+	for arg in test_elfs:
+		test_id, elf_file = arg.split(':', 1)
+		with open(elf_file, mode='rb') as i_f:
+			elf = i_f.read()
+		# Keep every custom test header word aligned
+		elf += b'\0' * (-len(elf) % 4)
+		tests.append((int(test_id, 0), elf))
+	tests.sort(key=lambda test: test[0])
+	for i in range(1, len(tests)):
+		if (tests[i][0] == tests[i-1][0]):
+			print("\nDuplicate test_id %d" %(tests[i][0]))
+			sys.exit(1)
+	return tests
+
+def gen_combine_binary(tests):
+	"""
+	Generate the combined binary:
+	test directory, (custom test header + test ELF) for each test, END marker
+	"""
+	entries = b''
+	images  = b''
+	offset  = DIR_HEADER_SIZE + (DIR_ENTRY_SIZE * len(tests))
+	for test_id, elf in tests:
+		entries += struct.pack('<IIII', test_id, offset, len(elf), zlib.crc32(elf) & 0xffffffff)
+		images  += struct.pack('<III', VAL_TEST_START_MARKER, test_id, len(elf)) + elf
+		offset  += TEST_HEADER_SIZE + len(elf)
+	header = struct.pack('<IIII', VAL_TEST_DIR_MARKER, VAL_TEST_DIR_VERSION, len(tests),
+			     zlib.crc32(entries) & 0xffffffff)
+	with open(out_binary, mode='wb') as o_f:
+		o_f.write(header + entries + images + struct.pack('<I', VAL_TEST_END_MARKER))
+	print("Combined %d tests into %s" %(len(tests), out_binary))
+
+# Call routines
+gen_combine_binary(read_tests())
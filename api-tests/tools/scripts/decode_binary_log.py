@@ -0,0 +1,336 @@
+#!/usr/bin/python
+#/** @file
+# * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+import os
+import re
+import sys
+import json
+from xml.sax.saxutils import escape, quoteattr
+
+if (len(sys.argv) < 2) or (len(sys.argv) > 4):
+	print("\nScript requires following inputs")
+	print("\narg1  : <INPUT  binary log captured from the UART, - for stdin>")
+	print("\narg2  : <INPUT  output format: text, json or junit> (optional, defaults to text)")
+	print("\narg3  : <INPUT  api-tests source directory> (optional, defaults to the one of this script)")
+	sys.exit(1)
+
+log_file     = sys.argv[1]
+out_format   = sys.argv[2] if (len(sys.argv) > 2) else "text"
+source_dir   = sys.argv[3] if (len(sys.argv) > 3) else os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..")
+
+if (out_format not in ["text", "json", "junit"]):
+	print("\nUnsupported output format %s" %(out_format))
+	sys.exit(1)
+
+# Keep in sync with val/nspe/val_log.h
+LOG_SYNC             = 0xA5
+LOG_MAX_PAYLOAD      = 24
+LOG_TAG_PRINT        = 0x1
+LOG_TAG_TEST_START   = 0x2
+LOG_TAG_TEST_END     = 0x3
+LOG_TAG_CHECKPOINT   = 0x4
+LOG_TAG_SUITE_REPORT = 0x5
+LOG_TAG_RESULT_TABLE = 0x6
+LOG_TAG_RESULT       = 0x7
+VAL_RESULT_MCYCLES   = 0x8000
+
+# Keep in sync with val/common/val.h
+TEST_START   = 0x01
+TEST_END     = 0x02
+TEST_PASS    = 0x04
+TEST_FAIL    = 0x08
+TEST_SKIP    = 0x10
+TEST_PENDING = 0x20
+VAL_STATUS_INVALID     = 0x10
+VAL_STATUS_INIT_FAILED = 0x1A
+
+token_re   = re.compile(r'//[^\n]*|/\*.*?\*/|"(?:[^"\\\n]|\\.)*"|\'(?:[^\'\\\n]|\\.)*\'', re.S)
+escape_re  = re.compile(r'\\(x[0-9a-fA-F]+|[0-7]{1,3}|.)', re.S)
+format_re  = re.compile(r'%(.?)', re.S)
+simple_escapes = {"n":"\n", "t":"\t", "r":"\r", "0":"\0", "a":"\a", "b":"\b", "f":"\f", "v":"\v"}
+
+def c_unescape(literal):
+	def replace(match):
+		seq = match.group(1)
+		if (seq[0] == "x"):
+			return chr(int(seq[1:], 16) & 0xFF)
+		if seq.isdigit() and (seq[0] in "01234567"):
+			return chr(int(seq, 8) & 0xFF)
+		return simple_escapes.get(seq, seq)
+	return escape_re.sub(replace, literal)
+
+def string_id(string):
+	"""
+	32-bit FNV-1a hash, as computed by val_log_string_id()
+	"""
+	value = 0x811C9DC5
+	for char in string.encode("latin-1", "replace"):
+		value = ((value ^ char) * 0x01000193) & 0xFFFFFFFF
+	return value
+
+def read_strings():
+	"""
+	Map the IDs of all the string literals of the C sources to the strings
+	"""
+	strings = {}
+	for root, dirs, files in os.walk(source_dir):
+		for name in files:
+			if not name.endswith((".c", ".h", ".inc")):
+				continue
+			with open(os.path.join(root, name), "r", errors="replace") as f:
+				source = f.read()
+			current = None
+			last_end = 0
+			for match in token_re.finditer(source):
+				token = match.group(0)
+				if (token[0] != '"'):
+					continue
+				value = c_unescape(token[1:-1])
+				# Adjacent literals are one string
+				if (current is not None) and (source[last_end:match.start()].strip() == ""):
+					current += value
+				else:
+					if (current is not None):
+						strings[string_id(current)] = current
+					current = value
+				last_end = match.end()
+			if (current is not None):
+				strings[string_id(current)] = current
+	return strings
+
+def to_int32(value):
+	return value - (1 << 32) if (value & 0x80000000) else value
+
+def format_print(string, data):
+	"""
+	Expands the format specifiers as pal_print_ns() does
+	"""
+	def replace(match):
+		spec = match.group(1)
+		if (spec == "d"):
+			return "%d" %(to_int32(data))
+		if (spec in ["x", "X"]):
+			return "%X" %(data)
+		return ""
+	return format_re.sub(replace, string)
+
+def read_frames(log):
+	"""
+	Yield (tag, payload) for each valid frame and (None, text) for the bytes between frames
+	"""
+	i = 0
+	text_start = 0
+	while (i < len(log)):
+		if (log[i] == LOG_SYNC) and (i + 3 <= len(log)):
+			tag = log[i + 1]
+			length = log[i + 2]
+			end = i + 3 + length
+			if (length <= LOG_MAX_PAYLOAD) and (end < len(log)):
+				check = 0
+				for byte in log[i + 1:end]:
+					check ^= byte
+				if (check == log[end]):
+					if (text_start < i):
+						yield None, log[text_start:i]
+					yield tag, log[i + 3:end]
+					i = end + 1
+					text_start = i
+					continue
+		i += 1
+	if (text_start < len(log)):
+		yield None, log[text_start:]
+
+def field(payload, offset, size):
+	return int.from_bytes(payload[offset:offset + size], "little")
+
+class Decoder:
+	def __init__(self, strings):
+		self.strings = strings
+		self.text = []
+		self.suites = []
+		self.tests = []
+		self.test = None
+		self.results = 0
+
+	def lookup(self, sid):
+		if (sid in self.strings):
+			return self.strings[sid]
+		return "<unknown string 0x%08X>" %(sid)
+
+	def emit(self, text):
+		self.text.append(text)
+		if (self.test is not None):
+			self.test["output"].append(text)
+
+	def test_start(self, payload):
+		self.test = {"id": field(payload, 0, 2),
+			     "description": self.lookup(field(payload, 2, 4)).strip(),
+			     "result": "SIM ERROR", "code": 0, "output": []}
+		self.tests.append(self.test)
+		self.emit("\nTEST: %d | DESCRIPTION: " %(self.test["id"]))
+		self.emit(self.lookup(field(payload, 2, 4)))
+
+	def test_end(self, payload):
+		state = payload[0]
+		status = payload[1]
+		if (state == TEST_START):
+			result, code, line = "FAILED", VAL_STATUS_INIT_FAILED, "FAILED (Error Code=0x%X)"
+		elif (state == TEST_END):
+			result, code, line = "PASSED", status, "PASSED "
+		elif (state == TEST_FAIL):
+			result, code, line = "FAILED", status, "FAILED (Error Code=0x%X) "
+		elif (state == TEST_SKIP):
+			result, code, line = "SKIPPED", status, "SKIPPED (Skip Code=0x%X)"
+		elif (state == TEST_PENDING):
+			result, code, line = "SIM ERROR", status, "SIM ERROR (Error Code=0x%X)"
+		else:
+			result, code, line = "FAILED", VAL_STATUS_INVALID, "FAILED(Error Code=0x%X)"
+		if (self.test is not None):
+			self.test["result"] = result
+			self.test["code"] = code
+		self.emit("TEST RESULT: " + (line %(code) if ("%" in line) else line) + "\n")
+		if (len(payload) >= 14):
+			self.test_timing(payload[2:])
+		self.emit("\n******************************************\n")
+
+	def test_timing(self, payload):
+		kcycles = field(payload, 0, 4)
+		checkpoints = field(payload, 4, 2)
+		line = "TEST TIMING: %d kcycles" %(kcycles)
+		if checkpoints:
+			line += ", slowest checkpoint %d (%d cycles)" %(field(payload, 6, 2), to_int32(field(payload, 8, 4)))
+		if (self.test is not None):
+			self.test["kcycles"] = kcycles
+		self.emit(line + "\n")
+
+	def result_table(self, payload):
+		self.results = payload[0]
+		self.emit("\n************ Result Table ****************\n")
+		if (self.results == 0):
+			self.emit("******************************************\n")
+
+	def result(self, payload):
+		states = {TEST_PASS: "PASSED   ", TEST_FAIL: "FAILED   ", TEST_SKIP: "SKIPPED  "}
+		elapsed = field(payload, 6, 2)
+		line = "%d | %s | STATUS 0x%X | CHECKPOINT %d" %(field(payload, 0, 2),
+			states.get(payload[2], "SIM ERROR"), payload[3], field(payload, 4, 2))
+		if (elapsed & VAL_RESULT_MCYCLES):
+			line += " | %d Mcycles" %(elapsed & (VAL_RESULT_MCYCLES - 1))
+		elif elapsed:
+			line += " | %d kcycles" %(elapsed)
+		self.emit(line + "\n")
+		if (self.results > 0):
+			self.results -= 1
+			if (self.results == 0):
+				self.emit("******************************************\n")
+
+	def suite_report(self, payload):
+		self.test = None
+		suite = {"name": self.lookup(field(payload, 0, 4)),
+			 "passed": payload[4], "sim_error": payload[5],
+			 "failed": payload[6], "skipped": payload[7],
+			 "tests": self.tests}
+		self.tests = []
+		self.suites.append(suite)
+		self.emit("\n************ %s Report **********\n" %(suite["name"]))
+		self.emit("TOTAL TESTS     : %d\n" %(suite["passed"] + suite["sim_error"]
+							+ suite["failed"] + suite["skipped"]))
+		self.emit("TOTAL PASSED    : %d\n" %(suite["passed"]))
+		self.emit("TOTAL SIM ERROR : %d\n" %(suite["sim_error"]))
+		self.emit("TOTAL FAILED    : %d\n" %(suite["failed"]))
+		self.emit("TOTAL SKIPPED   : %d\n" %(suite["skipped"]))
+		if (len(payload) >= 18):
+			suite["kcycles"] = field(payload, 8, 4)
+			suite["slowest_test"] = field(payload, 12, 2)
+			self.emit("TOTAL KCYCLES   : %d\n" %(suite["kcycles"]))
+			self.emit("SLOWEST TEST    : %d (%d kcycles)\n" %(suite["slowest_test"], field(payload, 14, 4)))
+		self.emit("******************************************\n")
+
+	def decode(self, log):
+		for tag, payload in read_frames(log):
+			if (tag is None):
+				self.emit(payload.decode("latin-1").replace("\r", ""))
+			elif (tag == LOG_TAG_PRINT) and (len(payload) >= 4):
+				# Values shorter than 4 bytes are not negative
+				data = field(payload, 4, len(payload) - 4)
+				self.emit(format_print(self.lookup(field(payload, 0, 4)), data))
+			elif (tag == LOG_TAG_TEST_START) and (len(payload) >= 6):
+				self.test_start(payload)
+			elif (tag == LOG_TAG_TEST_END) and (len(payload) >= 2):
+				self.test_end(payload)
+			elif (tag == LOG_TAG_CHECKPOINT) and (len(payload) >= 6):
+				self.emit("\t[Timing] Checkpoint %d : %d cycles\n"
+					  %(field(payload, 0, 2), to_int32(field(payload, 2, 4))))
+			elif (tag == LOG_TAG_SUITE_REPORT) and (len(payload) >= 8):
+				self.suite_report(payload)
+			elif (tag == LOG_TAG_RESULT_TABLE) and (len(payload) >= 1):
+				self.result_table(payload)
+			elif (tag == LOG_TAG_RESULT) and (len(payload) >= 8):
+				self.result(payload)
+		# A run cut short still reports the tests it started
+		if self.tests:
+			self.suites.append({"name": "Incomplete run", "tests": self.tests})
+			self.tests = []
+
+def write_junit(suites):
+	print('<?xml version="1.0" encoding="UTF-8"?>')
+	print("<testsuites>")
+	for suite in suites:
+		tests = suite["tests"]
+		failures = len([t for t in tests if (t["result"] == "FAILED")])
+		errors = len([t for t in tests if (t["result"] == "SIM ERROR")])
+		skipped = len([t for t in tests if (t["result"] == "SKIPPED")])
+		print("  <testsuite name=%s tests=\"%d\" failures=\"%d\" errors=\"%d\" skipped=\"%d\">"
+		      %(quoteattr(suite["name"]), len(tests), failures, errors, skipped))
+		for test in tests:
+			print("    <testcase classname=%s name=%s>"
+			      %(quoteattr(suite["name"]), quoteattr("%d: %s" %(test["id"], test["description"]))))
+			message = quoteattr("Error Code=0x%X" %(test["code"]))
+			if (test["result"] == "FAILED"):
+				print("      <failure message=%s/>" %(message))
+			elif (test["result"] == "SIM ERROR"):
+				print("      <error message=%s/>" %(message))
+			elif (test["result"] == "SKIPPED"):
+				print("      <skipped message=%s/>" %(quoteattr("Skip Code=0x%X" %(test["code"]))))
+			print("      <system-out>%s</system-out>" %(escape("".join(test["output"]))))
+			print("    </testcase>")
+		print("  </testsuite>")
+	print("</testsuites>")
+
+def decode_log():
+	if (log_file == "-"):
+		log = sys.stdin.buffer.read()
+	else:
+		with open(log_file, "rb") as f:
+			log = f.read()
+
+	decoder = Decoder(read_strings())
+	decoder.decode(log)
+
+	if (out_format == "text"):
+		sys.stdout.write("".join(decoder.text))
+	elif (out_format == "json"):
+		for suite in decoder.suites:
+			for test in suite["tests"]:
+				test["output"] = "".join(test["output"])
+		print(json.dumps({"suites": decoder.suites}, indent=2))
+	else:
+		write_junit(decoder.suites)
+
+# Call routines
+decode_log()
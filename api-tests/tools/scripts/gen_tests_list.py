@@ -44,7 +44,7 @@ server_tests_list_declare  = sys.argv[9]
 server_tests_list          = sys.argv[10]
 
 # Dictionary to hold the mapping between suite and the base number
-suite_with_base_dict = {"ipc":0, "crypto":1, "protected_storage":2, "internal_trusted_storage":3, "initial_attestation":4}
+suite_with_base_dict = {"ipc":0, "crypto":1, "protected_storage":2, "internal_trusted_storage":3, "initial_attestation":4, "crypto_perf":5, "storage_perf":6, "ipc_perf":7}
 
 def gen_test_list():
 	"""
@@ -122,5 +122,5 @@ def gen_secure_tests_list():
 # Call routines
 gen_test_list()
 gen_test_entry_info()
-if (suite == "ipc"):
+if (suite in ("ipc", "ipc_perf")):
 	gen_secure_tests_list()
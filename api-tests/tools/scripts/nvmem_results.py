@@ -0,0 +1,141 @@
+#!/usr/bin/python
+#/** @file
+# * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+import sys
+import json
+import struct
+
+if (len(sys.argv) < 2) or (len(sys.argv) > 3):
+	print("\nScript requires following inputs")
+	print("\narg1  : <INPUT  NVMEM image, psa_nvmem.bin for the host target, or a memory")
+	print("\n                 dump of the NVMEM region of the target>")
+	print("\narg2  : <INPUT  output format: text or json> (optional, defaults to text)")
+	sys.exit(1)
+
+in_file    = sys.argv[1]
+out_format = sys.argv[2] if (len(sys.argv) > 2) else "text"
+
+# Keep in sync with val/common/val.h, val/nspe/val_dispatcher.h and val/nspe/val_peripherals.h
+NV_TEST_CNT_OFFSET     = 4 * 0x3
+NV_RESULT_CNT_OFFSET   = 4 * 0x12
+NV_RESULT_TABLE_OFFSET = 4 * 0x13
+VAL_RESULT_TABLE_SIZE  = 96
+VAL_RESULT_MCYCLES     = 0x8000
+TEST_RESULT_SIZE       = 8
+NV_WD_PROFILE_OFFSET   = 4 * 0xD3
+VAL_WD_PROFILE_MAGIC   = 0x5744
+VAL_WD_PROFILE_TESTS   = 128
+VAL_WD_PROFILE_UNIT_MS = 20
+VAL_WD_PROFILE_SLOW    = 0xFF
+VAL_MAX_TEST_PER_COMP  = 200
+NV_RUN_CNT_OFFSET      = 4 * 0xF4
+
+states = {0x04: "PASSED", 0x08: "FAILED", 0x10: "SKIPPED", 0x20: "SIM ERROR"}
+
+def read_results(nvmem):
+	"""
+	Returns the suite counters and the entries of the result table
+	"""
+	if (len(nvmem) < NV_RESULT_TABLE_OFFSET):
+		print("%s is too small for an NVMEM image" %(in_file))
+		sys.exit(1)
+
+	passed, skip, fail, sim_error = struct.unpack_from("<4B", nvmem, NV_TEST_CNT_OFFSET)
+	counts = {"passed": passed, "failed": fail, "skipped": skip, "sim_error": sim_error}
+
+	# Suites already done in a SUITE=ALL run
+	if (len(nvmem) >= NV_RUN_CNT_OFFSET + 4):
+		run = struct.unpack_from("<4B", nvmem, NV_RUN_CNT_OFFSET)
+		if (run != (0xFF, 0xFF, 0xFF, 0xFF)):
+			counts["passed"]    += run[0]
+			counts["skipped"]   += run[1]
+			counts["failed"]    += run[2]
+			counts["sim_error"] += run[3]
+
+	count = struct.unpack_from("<I", nvmem, NV_RESULT_CNT_OFFSET)[0]
+	if (count > VAL_RESULT_TABLE_SIZE):
+		# Table never written
+		count = 0
+	count = min(count, (len(nvmem) - NV_RESULT_TABLE_OFFSET) // TEST_RESULT_SIZE)
+
+	results = []
+	for i in range(count):
+		test_id, state, status, checkpoint, elapsed = struct.unpack_from("<HBBHH", nvmem,
+						NV_RESULT_TABLE_OFFSET + (i * TEST_RESULT_SIZE))
+		if (elapsed & VAL_RESULT_MCYCLES):
+			kcycles = (elapsed & (VAL_RESULT_MCYCLES - 1)) * 1000
+		else:
+			kcycles = elapsed
+		results.append({"id": test_id, "result": states.get(state, "UNKNOWN"),
+				"status": status, "checkpoint": checkpoint, "kcycles": kcycles})
+	return counts, results
+
+def read_wd_profile(nvmem):
+	"""
+	Returns the longest watchdog window in ms of each test in the watchdog timeout
+	profile, None for a window too long to record
+	"""
+	profile = {}
+	if (len(nvmem) < NV_WD_PROFILE_OFFSET + 4 + VAL_WD_PROFILE_TESTS):
+		return profile
+
+	magic, comp = struct.unpack_from("<HB", nvmem, NV_WD_PROFILE_OFFSET)
+	if (magic != VAL_WD_PROFILE_MAGIC):
+		return profile
+
+	for num in range(VAL_WD_PROFILE_TESTS):
+		window = nvmem[NV_WD_PROFILE_OFFSET + 4 + num]
+		if window:
+			profile[(comp * VAL_MAX_TEST_PER_COMP) + num] = (None if (window == VAL_WD_PROFILE_SLOW)
+									  else window * VAL_WD_PROFILE_UNIT_MS)
+	return profile
+
+def dump_results():
+	with open(in_file, "rb") as f:
+		nvmem = f.read()
+	counts, results = read_results(nvmem)
+	profile = read_wd_profile(nvmem)
+
+	if (out_format == "json"):
+		print(json.dumps({"counts": counts, "tests": results,
+				  "watchdog_windows_ms": profile}, indent=2))
+	elif (out_format == "text"):
+		print("TOTAL TESTS     : %d" %(sum(counts.values())))
+		print("TOTAL PASSED    : %d" %(counts["passed"]))
+		print("TOTAL SIM ERROR : %d" %(counts["sim_error"]))
+		print("TOTAL FAILED    : %d" %(counts["failed"]))
+		print("TOTAL SKIPPED   : %d" %(counts["skipped"]))
+		for test in results:
+			line = "%d | %-9s | STATUS 0x%x | CHECKPOINT %d" %(test["id"], test["result"],
+								      test["status"], test["checkpoint"])
+			if test["kcycles"]:
+				line += " | %d kcycles" %(test["kcycles"])
+			print(line)
+		for test_id in sorted(profile):
+			window = profile[test_id]
+			print("WATCHDOG WINDOW : %d | %s" %(test_id, ("%d ms" %(window)) if window else "too long"))
+	else:
+		print("Unsupported output format %s" %(out_format))
+		sys.exit(1)
+
+	# Non-zero exit status if any recorded test failed, for CI scripts
+	if any(test["result"] in ("FAILED", "SIM ERROR") for test in results):
+		sys.exit(2)
+
+# Call routines
+dump_results()
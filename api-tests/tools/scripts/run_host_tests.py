@@ -0,0 +1,186 @@
+#!/usr/bin/python
+#/** @file
+# * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+import os
+import re
+import sys
+import shutil
+import tempfile
+import subprocess
+import multiprocessing
+
+if (len(sys.argv) != 4) and (len(sys.argv) != 5):
+	print("\nScript requires following inputs")
+	print("\narg1  : <INPUT  SUITE identifier>")
+	print("\narg2  : <INPUT  testlist file>")
+	print("\narg3  : <INPUT  host test executable>")
+	print("\narg4  : <INPUT  number of worker processes> (optional, defaults to CPU count)")
+	sys.exit(1)
+
+suite         = sys.argv[1]
+testlist_file = sys.argv[2]
+executable    = os.path.abspath(sys.argv[3])
+if (len(sys.argv) == 5):
+	num_workers = int(sys.argv[4])
+else:
+	num_workers = multiprocessing.cpu_count()
+
+# Keep in sync with tools/scripts/gen_tests_list.py
+suite_with_base_dict = {"ipc":0, "crypto":1, "protected_storage":2, "internal_trusted_storage":3, "initial_attestation":4, "crypto_perf":5, "storage_perf":6}
+max_test_per_suite   = 200
+
+# Keep in sync with pal_host.h of tgt_dev_apis_linux_host
+PAL_HOST_ENV_NVMEM = "PSA_HOST_NVMEM"
+PAL_HOST_NVMEM_FILE = "psa_nvmem.bin"
+PAL_HOST_ARG_TESTS = "--tests"
+
+test_start_re  = re.compile(r"^TEST: (\d+) \|")
+test_result_re = re.compile(r"^TEST RESULT: ?(PASSED|FAILED|SKIPPED|SIM ERROR)")
+report_re      = re.compile(r"^\*+ (.*) Report \*+$")
+test_timing_re = re.compile(r"^TEST TIMING: (\d+) kcycles")
+
+def read_test_ids():
+	"""
+	Read the testlist file and return the test IDs in the order the dispatcher runs them
+	"""
+	if (suite not in suite_with_base_dict.keys()):
+		print("\nProvide a valid SUITE identifier")
+		sys.exit(1)
+
+	test_ids = []
+	with open(testlist_file, mode='r') as i_f:
+		for line in i_f:
+			line = line.strip()
+			if ('test_' == line[0:5]):
+				test_ids.append(int(line[6:9]) + (max_test_per_suite * suite_with_base_dict[suite]))
+	return test_ids
+
+def start_workers(shards):
+	"""
+	Start one host process per shard, each in a private directory holding its NVMEM
+	file and the files of a file based storage backend
+	"""
+	workers = []
+	for shard in shards:
+		work_dir = tempfile.mkdtemp(prefix="psa_worker_")
+		env = dict(os.environ)
+		env[PAL_HOST_ENV_NVMEM] = os.path.join(work_dir, PAL_HOST_NVMEM_FILE)
+		# A file rather than a pipe, so that no worker blocks on a full pipe
+		log = open(os.path.join(work_dir, "console.log"), mode='w+b')
+		proc = subprocess.Popen([executable, PAL_HOST_ARG_TESTS, ",".join([str(i) for i in shard])],
+					cwd=work_dir, env=env, stdout=log, stderr=subprocess.STDOUT)
+		workers.append((proc, log, work_dir, shard))
+	return workers
+
+def parse_output(output, results):
+	"""
+	Split the console output of a worker into per-test blocks.
+	Returns the lines printed before the first test and the suite name.
+	"""
+	header = []
+	suite_name = None
+	test_id = None
+	block = []
+	for line in output.splitlines():
+		match = test_start_re.match(line)
+		if match:
+			test_id = int(match.group(1))
+			block = [line]
+			continue
+
+		match = report_re.match(line)
+		if match:
+			suite_name = match.group(1)
+
+		if (test_id is None):
+			if (suite_name is None) and (len(results) == 0):
+				header.append(line)
+			continue
+
+		block.append(line)
+		match = test_result_re.match(line)
+		if match:
+			results[test_id] = [match.group(1), block]
+		elif (test_id in results) and line.startswith("*****"):
+			test_id = None
+	return header, suite_name
+
+def run_suite():
+	test_ids = read_test_ids()
+	if (len(test_ids) == 0):
+		print("\nNo tests found in %s" %(testlist_file))
+		sys.exit(1)
+
+	# Round-robin keeps neighbouring, similarly sized tests on different workers
+	num_shards = max(1, min(num_workers, len(test_ids)))
+	shards = [test_ids[i::num_shards] for i in range(num_shards)]
+
+	results = {}
+	header = []
+	suite_name = None
+	for proc, log, work_dir, shard in start_workers(shards):
+		proc.wait()
+		log.seek(0)
+		output = log.read().decode("utf-8", "replace")
+		log.close()
+		shutil.rmtree(work_dir, ignore_errors=True)
+		worker_header, worker_suite = parse_output(output, results)
+		if (len(header) == 0):
+			header = worker_header
+		if (suite_name is None):
+			suite_name = worker_suite
+		for test_id in shard:
+			if (test_id not in results):
+				results[test_id] = ["SIM ERROR", ["TEST: %d | worker exited with status %d"
+								%(test_id, proc.returncode),
+								"TEST RESULT: SIM ERROR (no result reported)", "",
+								"******************************************"]]
+
+	count = {"PASSED":0, "FAILED":0, "SKIPPED":0, "SIM ERROR":0}
+	total_kcycles = 0
+	slowest = None
+	print("\n".join(header))
+	for test_id in test_ids:
+		result, block = results[test_id]
+		count[result] += 1
+		print("\n".join(block))
+		for line in block:
+			match = test_timing_re.match(line)
+			if match:
+				kcycles = int(match.group(1))
+				total_kcycles += kcycles
+				if (slowest is None) or (kcycles > slowest[1]):
+					slowest = [test_id, kcycles]
+
+	print("\n************ %s Report **********" %(suite_name or "Suite"))
+	print("TOTAL TESTS     : %d" %(len(test_ids)))
+	print("TOTAL PASSED    : %d" %(count["PASSED"]))
+	print("TOTAL SIM ERROR : %d" %(count["SIM ERROR"]))
+	print("TOTAL FAILED    : %d" %(count["FAILED"]))
+	print("TOTAL SKIPPED   : %d" %(count["SKIPPED"]))
+	if slowest:
+		print("TOTAL KCYCLES   : %d" %(total_kcycles))
+		print("SLOWEST TEST    : %d (%d kcycles)" %(slowest[0], slowest[1]))
+	print("******************************************")
+	print("Workers         : %d" %(num_shards))
+
+	if (count["FAILED"] or count["SIM ERROR"]):
+		sys.exit(1)
+
+# Call routines
+run_suite()
@@ -40,6 +40,7 @@ section_name = sys.argv[7]
 minor_major_map = {}
 unique_major_groups = []
 unique_minor_components = []
+total_instances = 0
 
 if section_name == "NOSECTION":
 	section_name = ""
@@ -61,6 +62,7 @@ def get_minor_major_map():
 def generate_source():
 	"""" This method generates the source file which gets compiled on host machine.
 		The compiled output then generates the database file for a given target """
+	global total_instances
 	try:
 		with open(out_source, mode="a") as o_f:
 			o_f.write("#include <stdio.h>\n")
@@ -82,6 +84,7 @@ def generate_source():
 								o_f.write("\t%s_desc_t %s[%s] = {0};\n" %(minor_major_map[minor_comp.upper()].lower(), minor_comp, num))
 								o_f.write("\tint %s_num_instances = %s;\n" %(minor_comp, num))
 								num = int(num)
+								total_instances += num
 								for instance in range(num):
 									o_f.write("\t%s[%d].cfg_type.cfg_id = ((GROUP_%s << 24) + (%s_%s << 16) + %d);\n" \
 										%(minor_comp, instance, minor_major_map[minor_comp.upper()],\
@@ -158,6 +161,11 @@ def generate_source():
 			o_f.write("\ttotal_size += (8 + 8 + 4 + 4);\n")
 			o_f.write("\tfprintf(fp, \"0x%08x,\\n\", total_size);\n")
 
+			""" Index of (cfg_id, byte offset) pairs for the instance records of the database """
+			o_f.write("\tuint32_t index_id[%d], index_offset[%d], index_tmp;\n" %(total_instances + 1, total_instances + 1))
+			o_f.write("\tint      index_num = 0, i, j;\n")
+			o_f.write("\tuint32_t db_offset = sizeof(target_cfg_hdr_t);\n")
+
 			""" Start writing component values to database file """
 			for group in unique_major_groups:
 				o_f.write("\t/* Writing major group details to the file */\n")
@@ -166,15 +174,38 @@ def generate_source():
 				o_f.write("\t\tfprintf(fp, \"0x%08x,\\n\", *word_ptr);\n")
 				o_f.write("\t\tword_ptr++;\n")
 				o_f.write("\t}\n")
+				o_f.write("\tdb_offset += sizeof(group_%s);\n" %(group.lower()))
 				o_f.write("\t/* Writing minor group details to the file */\n")
 				for minor in unique_minor_components:
 					if group == minor_major_map[minor]:
+						o_f.write("\tfor(i=0; i<%s_num_instances; i++) {\n" %(minor.lower()))
+						o_f.write("\t\tindex_id[index_num] = %s[i].cfg_type.cfg_id;\n" %(minor.lower()))
+						o_f.write("\t\tindex_offset[index_num++] = db_offset + i * (sizeof(%s)/%s_num_instances);\n" %(minor.lower(), minor.lower()))
+						o_f.write("\t}\n")
+						o_f.write("\tdb_offset += sizeof(%s);\n" %(minor.lower()))
 						o_f.write("\tword_ptr = (uint32_t *)&%s[0];\n" %(minor.lower()))
 						o_f.write("\tfor(byte_no=0; byte_no<sizeof(%s); byte_no += 4) {\n" %(minor.lower()))
 						o_f.write("\t\tfprintf(fp, \"0x%08x,\\n\", *word_ptr);\n")
 						o_f.write("\t\tword_ptr++;\n")
 						o_f.write("\t}\n")
 			o_f.write("\tfprintf(fp, \"0x%08x\\n\", 0xffffffff);\n")
+			o_f.write("\tfprintf(fp, \"};\\n\\n\");\n\n")
+
+			""" Sort the index on cfg_id and write it out for the binary search in val_target.c """
+			o_f.write("\tfor(i=1; i<index_num; i++) {\n")
+			o_f.write("\t\tfor(j=i; (j>0) && (index_id[j-1] > index_id[j]); j--) {\n")
+			o_f.write("\t\t\tindex_tmp = index_id[j]; index_id[j] = index_id[j-1]; index_id[j-1] = index_tmp;\n")
+			o_f.write("\t\t\tindex_tmp = index_offset[j]; index_offset[j] = index_offset[j-1]; index_offset[j-1] = index_tmp;\n")
+			o_f.write("\t\t}\n")
+			o_f.write("\t}\n")
+			o_f.write("\tfprintf(fp, \"#define %s_INDEX_ENTRIES %%d\\n\", index_num);\n" %(table_name.upper()))
+			if section_name:
+				o_f.write("\tfprintf(fp, \"__attribute__((section(\\\"%s\\\")))\\n\");\n" %(section_name))
+			o_f.write("\tfprintf(fp, \"const uint32_t static %s_index[] = {\\n\");\n" %(table_name))
+			o_f.write("\tfor(i=0; i<index_num; i++) {\n")
+			o_f.write("\t\tfprintf(fp, \"0x%08x, 0x%08x,\\n\", index_id[i], index_offset[i]);\n")
+			o_f.write("\t}\n")
+			o_f.write("\tfprintf(fp, \"0x%08x, 0x%08x\\n\", 0xffffffff, 0xffffffff);\n")
 			o_f.write("\tfprintf(fp, \"};\\n\\n\");\n")
 			o_f.write("\tfprintf(fp, \"#endif\\n\");\n")
 			o_f.write("\treturn 0;\n")
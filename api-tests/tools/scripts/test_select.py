@@ -0,0 +1,117 @@
+#!/usr/bin/python
+#/** @file
+# * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+import os
+import sys
+import struct
+
+if (len(sys.argv) < 3) or (len(sys.argv) > 4):
+	print("\nScript requires following inputs")
+	print("\narg1  : <INPUT/OUTPUT  NVMEM image to update, psa_nvmem.bin for the host target>")
+	print("\narg2  : <INPUT  test selection: all, failed, or <id>,<first>-<last>,!<id>,!<first>-<last>,...")
+	print("\n                 ranges without ! are run, ranges with ! are left out.")
+	print("\n                 failed can be combined with ranges, e.g. failed,601-610.")
+	print("\n                 calibrate records the watchdog timeout profile in the run,")
+	print("\n                 and can be combined in the same way>")
+	print("\narg3  : <INPUT  nvmem to update the NVMEM image, record to only write the selection")
+	print("\n                 record, to be loaded at the NVMEM start + 0x%x> (optional, defaults to nvmem)" %(4 * 0xA))
+	sys.exit(1)
+
+out_file   = sys.argv[1]
+selection  = sys.argv[2]
+out_format = sys.argv[3] if (len(sys.argv) > 3) else "nvmem"
+
+# Keep in sync with val/common/val.h and val/nspe/val_dispatcher.h
+NV_TEST_SELECT_OFFSET        = 4 * 0xA
+VAL_TEST_SELECT_MAGIC        = 0x4c455354
+VAL_TEST_SELECT_MAX_RANGES   = 6
+VAL_TEST_SELECT_RERUN_FAILED = 0x1
+VAL_TEST_SELECT_WD_CALIBRATE = 0x2
+
+def parse_selection(selection):
+	"""
+	Returns the flags, the include ranges and the exclude ranges of the selection
+	"""
+	flags = 0
+	include = []
+	exclude = []
+	if (selection == "all"):
+		return flags, include, exclude
+
+	for item in selection.split(","):
+		if (item == "failed"):
+			flags |= VAL_TEST_SELECT_RERUN_FAILED
+			continue
+		if (item == "calibrate"):
+			flags |= VAL_TEST_SELECT_WD_CALIBRATE
+			continue
+		ranges = include
+		if item.startswith("!"):
+			ranges = exclude
+			item = item[1:]
+		bounds = item.split("-")
+		if (len(bounds) > 2) or not all(bound.isdigit() for bound in bounds):
+			print("Invalid test selection %s" %(item))
+			sys.exit(1)
+		first = int(bounds[0])
+		last = int(bounds[-1])
+		if (first > last) or (last > 0xFFFF):
+			print("Invalid test ID range %s" %(item))
+			sys.exit(1)
+		ranges.append((first, last))
+
+	if ((len(include) + len(exclude)) > VAL_TEST_SELECT_MAX_RANGES):
+		print("At most %d ranges can be selected" %(VAL_TEST_SELECT_MAX_RANGES))
+		sys.exit(1)
+	return flags, include, exclude
+
+def make_record(selection):
+	flags, include, exclude = parse_selection(selection)
+	if (flags == 0) and (not include) and (not exclude):
+		# No magic, all the tests run
+		return bytes(4 + 2 + 1 + 1 + (4 * VAL_TEST_SELECT_MAX_RANGES))
+
+	ranges = include + exclude
+	ranges += [(0, 0)] * (VAL_TEST_SELECT_MAX_RANGES - len(ranges))
+	record = struct.pack("<IHBB", VAL_TEST_SELECT_MAGIC, flags, len(include), len(exclude))
+	for first, last in ranges:
+		record += struct.pack("<HH", first, last)
+	return record
+
+def write_selection():
+	record = make_record(selection)
+
+	if (out_format == "record"):
+		with open(out_file, "wb") as f:
+			f.write(record)
+		print("Test selection record written to %s, load it at the NVMEM start + 0x%x"
+		      %(out_file, NV_TEST_SELECT_OFFSET))
+		return
+
+	if (out_format != "nvmem"):
+		print("Unsupported output format %s" %(out_format))
+		sys.exit(1)
+
+	mode = "r+b" if os.path.exists(out_file) else "w+b"
+	with open(out_file, mode) as f:
+		f.seek(NV_TEST_SELECT_OFFSET)
+		f.write(record)
+	print("Test selection written to %s" %(out_file))
+
+# Call routines
+write_selection()
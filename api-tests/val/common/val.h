@@ -88,6 +88,9 @@
 #define VAL_PROTECTED_STORAGE_BASE             2
 #define VAL_INTERNAL_TRUSTED_STORAGE_BASE      3
 #define VAL_INITIAL_ATTESTATION_BASE           4
+#define VAL_CRYPTO_PERF_BASE                   5
+#define VAL_STORAGE_PERF_BASE                  6
+#define VAL_IPC_PERF_BASE                      7
 
 #define VAL_GET_COMP_NUM(test_id)      \
    ((test_id - (test_id % VAL_MAX_TEST_PER_COMP)) / VAL_MAX_TEST_PER_COMP)
@@ -122,6 +125,18 @@
     do {                                         \
     } while(1)
 
+/* Marks a checkpoint reached without error. Timed by the VAL for the NSPE tests,
+   see val_interfaces.h */
+#ifndef TEST_CHECKPOINT_SAMPLE
+#define TEST_CHECKPOINT_SAMPLE(num)         do { } while (0)
+#endif
+
+/* Marks the checkpoint at which a test failed. Kept in the result table by the VAL
+   for the NSPE tests */
+#ifndef TEST_CHECKPOINT_FAILED
+#define TEST_CHECKPOINT_FAILED(num)         do { } while (0)
+#endif
+
 #define TEST_ASSERT_EQUAL(arg1, arg2, checkpoint)                                   \
     do {                                                                            \
         if ((arg1) != arg2)                                                         \
@@ -129,8 +144,10 @@
             val->print(PRINT_ERROR, "\tFailed at Checkpoint: %d\n", checkpoint);    \
             val->print(PRINT_ERROR, "\tActual: %d\n", arg1);                        \
             val->print(PRINT_ERROR, "\tExpected: %d\n", arg2);                      \
+            TEST_CHECKPOINT_FAILED(checkpoint);                                     \
             return 1;                                                               \
         }                                                                           \
+        TEST_CHECKPOINT_SAMPLE(checkpoint);                                         \
     } while (0)
 
 #define TEST_ASSERT_DUAL(arg1, status1, status2, checkpoint)                        \
@@ -141,8 +158,10 @@
             val->print(PRINT_ERROR, "\tActual: %d\n", arg1);                        \
             val->print(PRINT_ERROR, "\tExpected: %d", status1);                     \
             val->print(PRINT_ERROR, "or %d\n", status2);                            \
+            TEST_CHECKPOINT_FAILED(checkpoint);                                     \
             return 1;                                                               \
         }                                                                           \
+        TEST_CHECKPOINT_SAMPLE(checkpoint);                                         \
     } while (0)
 
 #define TEST_ASSERT_NOT_EQUAL(arg1, arg2, checkpoint)                               \
@@ -151,8 +170,10 @@
         {                                                                           \
             val->print(PRINT_ERROR, "\tFailed at Checkpoint: %d\n", checkpoint);    \
             val->print(PRINT_ERROR, "\tValue: %d\n", arg1);                         \
+            TEST_CHECKPOINT_FAILED(checkpoint);                                     \
             return 1;                                                               \
         }                                                                           \
+        TEST_CHECKPOINT_SAMPLE(checkpoint);                                         \
     } while (0)
 
 #define TEST_ASSERT_MEMCMP(buf1, buf2, size, checkpoint)                            \
@@ -161,8 +182,10 @@
         {                                                                           \
             val->print(PRINT_ERROR, "\tFailed at Checkpoint: %d : ", checkpoint);   \
             val->print(PRINT_ERROR, "Unequal data in compared buffers\n", 0);       \
+            TEST_CHECKPOINT_FAILED(checkpoint);                                     \
             return 1;                                                               \
         }                                                                           \
+        TEST_CHECKPOINT_SAMPLE(checkpoint);                                         \
     } while (0)
 
 /* enums */
@@ -206,8 +229,22 @@ typedef enum {
     NV_TEST_DATA1       = 0x4,
     NV_TEST_DATA2       = 0x5,
     NV_TEST_DATA3       = 0x6,
+    NV_TEST_KCYCLES     = 0x7,
+    NV_SLOWEST_TEST_ID  = 0x8,
+    NV_SLOWEST_KCYCLES  = 0x9,
+    NV_TEST_SELECT      = 0xA,  /* test_select_t, up to NV_RESULT_CNT */
+    NV_RESULT_CNT       = 0x12,
+    NV_RESULT_TABLE     = 0x13, /* NV_RESULT_CNT entries of test_result_t */
+    NV_WD_PROFILE       = 0xD3, /* wd_profile_t, after VAL_RESULT_TABLE_SIZE entries */
+    NV_RUN_CNT          = 0xF4, /* Totals of the suites reported before, multi-suite image */
+    NV_RUN_KCYCLES      = 0xF5,
+    NV_RUN_SLOWEST_ID   = 0xF6,
+    NV_RUN_SLOWEST_KCYCLES = 0xF7,
+    NV_TEST_CURSOR      = 0xF8, /* Test state kept across resets, up to the end of 1KB */
 } nvmem_index_t;
 
+#define VAL_TEST_CURSOR_SIZE          32
+
 /* enums to report test sub-state */
 typedef enum {
   VAL_STATUS_SUCCESS                     = 0x0,
@@ -268,6 +305,8 @@ typedef enum {
     TEST_ISOLATION_PSA_ROT_HEAP_WR       = 10,
     TEST_ISOLATION_PSA_ROT_MMIO_RD       = 11,
     TEST_ISOLATION_PSA_ROT_MMIO_WR       = 12,
+    TEST_CYCLE_COUNTER_READ              = 13,   /* Timing of the secure performance tests */
+    TEST_IRQ_LATENCY                     = 14,   /* Latency of the driver partition interrupt */
 } driver_test_fn_id_t;
 
 /* typedef's */
@@ -297,4 +336,94 @@ typedef struct {
 
 typedef int32_t (*client_test_t)(security_t caller);
 typedef int32_t (*server_test_t)(void);
+
+/* Performance measurement */
+#define VAL_PERF_WINDOW_DIV         10      /* Measure for 1/10 s when the clock rate is known */
+#define VAL_PERF_WINDOW_CYCLES      2500000 /* otherwise for this many cycles */
+#define VAL_PERF_MAX_ITERATIONS     1024
+#define VAL_PERF_READ_RUNS          4       /* Timed counter reads, secure partitions read the
+                                               counter through the driver partition */
+
+/* Operation under measurement, returns 0 on success */
+typedef int32_t (*val_perf_fn_t)(void *ctx);
+
+typedef struct {
+    uint32_t iterations;
+    uint32_t cycles;
+    uint32_t freq_hz;        /* Cycle counter rate, 0 if not known */
+} val_perf_result_t;
+
+/* Latency measurement, each operation is timed on its own */
+#define VAL_PERF_MAX_SAMPLES        100
+
+typedef struct {
+    uint32_t iterations;
+    uint32_t mean;           /* Cycles per operation */
+    uint32_t p99;            /* 99th percentile of the cycles per operation */
+    uint32_t max;
+    uint32_t freq_hz;        /* Cycle counter rate, 0 if not known */
+} val_perf_latency_t;
+
+/* Concurrency stress, an operation runs on several Non-secure threads at once for
+   VAL_STRESS_WINDOW_SEC, or VAL_STRESS_WINDOW_CYCLES if the counter rate is not known */
+#define VAL_STRESS_MAX_THREADS      8
+#define VAL_STRESS_WINDOW_SEC       1
+#define VAL_STRESS_WINDOW_CYCLES    (VAL_PERF_WINDOW_CYCLES * 10)
+#define VAL_STRESS_HIST_BUCKETS     33      /* Bit length of the cycles of one operation */
+#define VAL_STRESS_STARVE_DIV       8       /* Threads below this fraction of the mean
+                                               number of operations are starved */
+
+/* Operation under stress, thread is the index of the calling thread, returns 0 on success */
+typedef int32_t (*val_stress_fn_t)(void *ctx, uint32_t thread);
+
+typedef struct {
+    uint32_t threads;
+    uint32_t cycles;         /* Length of the run */
+    uint32_t freq_hz;        /* Cycle counter rate, 0 if not known */
+    uint32_t ops;            /* Operations completed by all the threads */
+    uint32_t errors;         /* Operations which failed, not counted in ops */
+    uint32_t min_ops;        /* Fewest and most operations completed by one thread */
+    uint32_t max_ops;
+    uint32_t fairness;       /* Jain's fairness index of the operations per thread, per mille */
+    uint32_t p99;            /* Upper bound of the 99th percentile of the cycles per operation */
+    uint32_t max;
+    uint32_t starved;        /* Threads with less than 1/VAL_STRESS_STARVE_DIV of the mean */
+} val_stress_result_t;
+
+/* Interrupt latency, measured by the driver partition on its own interrupt line */
+#define VAL_IRQ_HIST_BUCKETS        33      /* Bit length of the trigger to psa_wait cycles */
+
+typedef struct {
+    uint32_t iterations;
+    uint32_t freq_hz;        /* Cycle counter rate, 0 if not known */
+    uint32_t overhead;       /* Cycles of one counter read, taken off the timings */
+    uint32_t wait_min;       /* Interrupt trigger to the return of psa_wait with its signal */
+    uint32_t wait_mean;
+    uint32_t wait_max;
+    uint32_t eoi_min;        /* Call to return of psa_eoi */
+    uint32_t eoi_mean;
+    uint32_t eoi_max;
+    uint32_t hist[VAL_IRQ_HIST_BUCKETS];
+} val_irq_latency_t;
+
+/* Test timing, sampled at test init, at each checkpoint and at test exit */
+typedef enum {
+    TIMING_IDLE     = 0x0,
+    TIMING_RUNNING  = 0x1,
+    TIMING_DONE     = 0x2,
+} timing_state_t;
+
+typedef struct {
+    uint64_t cycles;             /* Test init to exit */
+    uint32_t last;               /* Counter value at the previous sample */
+    uint32_t max_check_cycles;   /* Longest interval ending at a checkpoint */
+    uint16_t max_checkpoint;     /* Checkpoint ending that interval */
+    uint16_t checkpoints;        /* Number of checkpoints reached */
+    uint8_t  state;              /* timing_state_t */
+} val_test_timing_t;
+
+#define VAL_KCYCLES(cycles)         ((uint32_t)(((cycles) + 500) / 1000))
+
+/* Direct crypto entry points, defined by the PAL in pal_crypto_intf.h when CRYPTO is set */
+typedef struct pal_crypto_ops_s val_crypto_ops_t;
 #endif /* VAL_COMMON_H */
@@ -30,6 +30,76 @@ __UNUSED STATIC_DECLARE val_status_t val_print
                         (print_verbosity_t verbosity, char *string, int32_t data);
 #endif
 
+#ifdef TARGET_DATABASE_INDEX_ENTRIES
+/* Number of most recently resolved config blocks kept for fast lookup */
+#define VAL_TARGET_CFG_CACHE_SIZE   4
+
+typedef struct {
+    cfg_id_t    cfg_id;
+    uint8_t     *data;
+} target_cfg_cache_t;
+
+__UNUSED static target_cfg_cache_t target_cfg_cache[VAL_TARGET_CFG_CACHE_SIZE];
+
+/**
+    @brief    - Looks up the given configuration ID in the config block cache and then
+                in the sorted index generated along with the target config database.
+    @param    - cfg_id   : Configuration ID of a block
+              - data     : Returns block base address
+    @return   - val_status_t
+**/
+STATIC_DECLARE val_status_t val_target_cfg_index_lookup(cfg_id_t cfg_id, uint8_t **data)
+{
+    uint32_t            i, low = 0, high = TARGET_DATABASE_INDEX_ENTRIES, mid;
+    target_cfg_cache_t  entry;
+
+    for (i = 0; i < VAL_TARGET_CFG_CACHE_SIZE; i++)
+    {
+        if (target_cfg_cache[i].cfg_id == cfg_id)
+        {
+            *data = target_cfg_cache[i].data;
+            entry = target_cfg_cache[i];
+            break;
+        }
+    }
+
+    if (i == VAL_TARGET_CFG_CACHE_SIZE)
+    {
+        i = VAL_TARGET_CFG_CACHE_SIZE - 1;
+        while (low < high)
+        {
+            mid = (low + high) / 2;
+            if (target_database_index[2 * mid] < cfg_id)
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+
+        if ((low == TARGET_DATABASE_INDEX_ENTRIES) || (target_database_index[2 * low] != cfg_id))
+        {
+            return VAL_STATUS_NOT_FOUND;
+        }
+
+        *data = (uint8_t *)&target_database + target_database_index[(2 * low) + 1];
+        entry.cfg_id = cfg_id;
+        entry.data = *data;
+    }
+
+    /* Keep the cache in most recently used order */
+    for (; i > 0; i--)
+    {
+        target_cfg_cache[i] = target_cfg_cache[i - 1];
+    }
+    target_cfg_cache[0] = entry;
+
+    return VAL_STATUS_SUCCESS;
+}
+#endif
+
 /**
     @brief    - Returns the base address of target configuration block database.
     @param    - blob     : Populates the base address
@@ -79,6 +149,14 @@ STATIC_DECLARE val_status_t val_target_get_cfg_blob(cfg_id_t cfg_id, uint8_t **d
     val_status_t    status;
     void            *config_blob = NULL;
 
+#ifdef TARGET_DATABASE_INDEX_ENTRIES
+    if (val_target_cfg_index_lookup(cfg_id, data) == VAL_STATUS_SUCCESS)
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+#endif
+
+    /* Walk the database for IDs which are not indexed */
     val_print(PRINT_INFO, "\tInput id is %x \n", cfg_id);
     do
     {
@@ -180,6 +180,9 @@ typedef struct _SOC_PER_INFO_DESC_ {
   dev_attr_t  attribute;
 } soc_peripheral_desc_t;
 
+/* intr_id of a peripheral whose interrupt is not used */
+#define INTR_ID_NONE    0xFF
+
 /**
   System Miscellaneous Information
 **/
@@ -102,6 +102,41 @@ int pal_uart_init_ns(uint32_t uart_base_addr);
 
 int pal_print_ns(char *str, int32_t data);
 
+/**
+ *   @brief    - This function sends the print data queued by pal_print_ns to the UART
+ *   @param    - void
+ *   @return   - SUCCESS/FAILURE
+**/
+
+int pal_print_flush_ns(void);
+
+/**
+ *   @brief    - Writes raw bytes to the UART, without any format or newline conversion
+ *   @param    - data     : Bytes to write
+ *             - size     : Number of bytes
+ *   @return   - SUCCESS/FAILURE. PAL_STATUS_UNSUPPORTED_FUNC if not supported.
+**/
+
+int pal_uart_write_ns(uint8_t *data, uint32_t size);
+
+/**
+ *   @brief    - Switches the UART to the interrupt driven TX mode, where the prints are
+ *               queued and sent from the UART TX interrupt
+ *   @param    - intr_id  : Interrupt number of the UART TX interrupt
+ *   @return   - SUCCESS/FAILURE. PAL_STATUS_UNSUPPORTED_FUNC if not supported.
+**/
+
+int pal_uart_tx_irq_init_ns(uint32_t intr_id);
+
+/**
+ *   @brief    - UART TX interrupt handler of the interrupt driven TX mode. To be called
+ *               from the UART TX interrupt vector of the platform.
+ *   @param    - void
+ *   @return   - void
+**/
+
+void pal_uart_tx_irq_handler_ns(void);
+
 /**
  *   @brief           - Initializes an hardware watchdog timer
  *   @param           - base_addr       : Base address of the watchdog module
@@ -153,6 +188,13 @@ int pal_nvmem_write_ns(addr_t base, uint32_t offset, void *buffer, int size);
 **/
 int32_t pal_crypto_function(int type, va_list valist);
 
+/**
+ *   @brief    - This API returns the table of direct crypto entry points
+ *   @param    - void
+ *   @return   - Pointer to the table, NULL if crypto is not supported
+**/
+const struct pal_crypto_ops_s *pal_crypto_get_ops(void);
+
 /**
  *   @brief    - This API will call the requested internal trusted storage function
  *   @param    - type    : function code
@@ -177,6 +219,37 @@ uint32_t pal_ps_function(int type, va_list valist);
 **/
 int32_t pal_attestation_function(int type, va_list valist);
 
+/**
+ *   @brief    - Enables the free running cycle counter of the CPU
+ *   @param    - freq_hz : Returns the counter frequency in Hz, 0 if not known
+ *   @return   - SUCCESS/FAILURE. PAL_STATUS_UNSUPPORTED_FUNC if there is no counter.
+**/
+int pal_cycle_counter_init_ns(uint32_t *freq_hz);
+
+/**
+ *   @brief    - Reads the cycle counter of the CPU
+ *   @param    - void
+ *   @return   - Counter value, wraps around at 32 bits
+**/
+uint32_t pal_cycle_counter_read_ns(void);
+
+/**
+ *   @brief    - Runs a function on several threads at once and waits for all of them to end
+ *   @param    - fn    : Function run by each thread
+ *               args  : Argument of each thread
+ *               count : Number of threads
+ *   @return   - SUCCESS/FAILURE. PAL_STATUS_UNSUPPORTED_FUNC if there are no threads.
+**/
+int pal_thread_run_ns(void (*fn)(void *arg), void **args, uint32_t count);
+
+/**
+ *   @brief    - Checks whether the given test is selected to run on this platform instance.
+ *               Deselected tests are not run and are not counted in the suite report.
+ *   @param    - test_id : Test ID
+ *   @return   - 1 if the test must run, 0 otherwise
+**/
+int pal_test_select_ns(uint32_t test_id);
+
 /**
  *   @brief    - Terminates the simulation at the end of all tests completion.
  *               By default, it put cpus into power down mode.
@@ -25,6 +25,9 @@ enum attestation_function_code {
     VAL_INITIAL_ATTEST_GET_TOKEN        = 0x1,
     VAL_INITIAL_ATTEST_GET_TOKEN_SIZE   = 0x2,
     VAL_INITIAL_ATTEST_VERIFY_TOKEN     = 0x3,
+    VAL_INITIAL_ATTEST_VERIFY_TOKEN_START  = 0x4,
+    VAL_INITIAL_ATTEST_VERIFY_TOKEN_UPDATE = 0x5,
+    VAL_INITIAL_ATTEST_VERIFY_TOKEN_FINISH = 0x6,
 };
 
 int32_t val_attestation_function(int type, ...);
@@ -41,3 +41,18 @@ int32_t val_crypto_function(int type, ...)
     return VAL_STATUS_ERROR;
 #endif
 }
+
+/**
+    @brief    - This API returns the table of direct crypto entry points. The members
+                take the arguments of the psa_* function of the same name.
+    @param    - void
+    @return   - Pointer to the table, NULL if crypto is not supported
+**/
+const val_crypto_ops_t *val_crypto_get_ops(void)
+{
+#ifdef CRYPTO
+    return pal_crypto_get_ops();
+#else
+    return NULL;
+#endif
+}
@@ -20,6 +20,10 @@
 
 #include "val.h"
 
+#ifdef CRYPTO
+#include "pal_crypto_intf.h"
+#endif
+
 #define BYTES_TO_BITS(byte)             (byte * 8)
 
 /* Size */
@@ -133,4 +137,5 @@ enum crypto_function_code {
 };
 
 int32_t val_crypto_function(int type, ...);
+const val_crypto_ops_t *val_crypto_get_ops(void);
 #endif /* _VAL_CRYPTO_H_ */
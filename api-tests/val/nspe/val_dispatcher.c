@@ -20,6 +20,7 @@
 #include "val_interfaces.h"
 #include "val_peripherals.h"
 #include "val_target.h"
+#include "val_log.h"
 
 extern val_api_t val_api;
 extern psa_api_t psa_api;
@@ -28,6 +29,11 @@ extern psa_api_t psa_api;
 addr_t          g_test_info_addr;
 uint32_t        combine_test_binary_in_ram;
 addr_t          combine_test_binary_addr;
+static test_select_t g_test_select;
+/* RAM copy of the result table in NVMEM. Entries from g_result_dirty on are not written yet */
+static test_result_t g_test_results[VAL_RESULT_TABLE_SIZE];
+static uint32_t      g_result_cnt;
+static uint32_t      g_result_dirty = VAL_RESULT_TABLE_SIZE;
 
 #if !defined(TEST_COMBINE_ARCHIVE)
 static const unsigned char elf_magic_header[ELF_IDENT] = {
@@ -117,8 +123,409 @@ int val_copy_elf(uint32_t saddr, uint32_t *info_addr)
     *info_addr = test_elfh.e_entry;
     return 0;
 }
+
+/**
+    @brief    - Computes CRC32 (IEEE 802.3) of the given region of combine_test_binary
+    @param    - addr : start address of the region
+                len  : length of the region in bytes
+                crc  : returns the computed CRC
+    @return   - error status
+**/
+static val_status_t val_mem_crc32(addr_t addr, uint32_t len, uint32_t *crc)
+{
+    uint8_t         chunk[64];
+    uint32_t        value = 0xFFFFFFFF;
+    uint32_t        size, i, bit;
+
+    while (len)
+    {
+        size = (len > sizeof(chunk)) ? sizeof(chunk) : len;
+        if (val_mem_copy(addr, chunk, size))
+        {
+            return VAL_STATUS_READ_FAILED;
+        }
+
+        for (i = 0; i < size; i++)
+        {
+            value ^= chunk[i];
+            for (bit = 0; bit < 8; bit++)
+            {
+                value = (value >> 1) ^ (0xEDB88320 & (0 - (value & 1)));
+            }
+        }
+        addr += size;
+        len  -= size;
+    }
+
+    *crc = ~value;
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Validates the test directory available at the start of combine_test_binary.
+                Images generated without the directory are left to the linear walk.
+    @return   - Number of valid directory entries, 0 if directory is not usable
+**/
+static uint32_t val_test_dir_init(void)
+{
+    test_dir_header_t   dir;
+    uint32_t            crc;
+
+    if (val_mem_copy(combine_test_binary_addr, (uint8_t *)&dir, sizeof(test_dir_header_t)))
+    {
+        return 0;
+    }
+
+    if (dir.marker != VAL_TEST_DIR_MARKER)
+    {
+        return 0;
+    }
+
+    if ((dir.version != VAL_TEST_DIR_VERSION) || (dir.num_entries == 0)
+        || val_mem_crc32(combine_test_binary_addr + sizeof(test_dir_header_t),
+                         dir.num_entries * sizeof(test_dir_entry_t), &crc)
+        || (crc != dir.crc32))
+    {
+        val_print(PRINT_WARN, "\n\tInvalid test directory, falling back to linear scan", 0);
+        return 0;
+    }
+
+    return dir.num_entries;
+}
+
+/**
+    @brief    - Looks up the test which follows test_id_prev in the test directory
+    @param    - test_id_prev : Previous test ID, VAL_INVALID_TEST_ID for the first test
+                num_entries  : Number of directory entries
+                entry        : Returns the directory entry. entry->test_id is set to
+                               VAL_INVALID_TEST_ID if no more tests are available.
+    @return   - error status
+**/
+static val_status_t val_test_dir_lookup(test_id_t test_id_prev, uint32_t num_entries,
+                                        test_dir_entry_t *entry)
+{
+    addr_t      table = combine_test_binary_addr + sizeof(test_dir_header_t);
+    uint32_t    low = 0, high = num_entries, mid;
+
+    if (test_id_prev != VAL_INVALID_TEST_ID)
+    {
+        /* Binary search for the first entry with test_id greater than test_id_prev */
+        while (low < high)
+        {
+            mid = low + ((high - low) / 2);
+            if (val_mem_copy(table + (mid * sizeof(test_dir_entry_t)),
+                             (uint8_t *)entry, sizeof(test_dir_entry_t)))
+            {
+                return VAL_STATUS_READ_FAILED;
+            }
+
+            if (entry->test_id <= test_id_prev)
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+    }
+
+    if (low >= num_entries)
+    {
+        entry->test_id = VAL_INVALID_TEST_ID;
+        return VAL_STATUS_SUCCESS;
+    }
+
+    return val_mem_copy(table + (low * sizeof(test_dir_entry_t)),
+                        (uint8_t *)entry, sizeof(test_dir_entry_t));
+}
 #endif
 
+/**
+    @brief    - Reads the test selection and the result table from NVMEM. On the first
+                boot of a run which does not rerun the failed tests, the result table
+                is cleared.
+    @param    - test_id_prev : Previous test ID, VAL_INVALID_TEST_ID on the first boot
+    @return   - error status
+**/
+static val_status_t val_test_select_init(test_id_t test_id_prev)
+{
+    val_status_t    status;
+
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_SELECT), &g_test_select,
+                            sizeof(test_select_t));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    /* NVMEM which was never written selects all the tests */
+    if ((g_test_select.magic != VAL_TEST_SELECT_MAGIC) ||
+        ((g_test_select.num_include + g_test_select.num_exclude) > VAL_TEST_SELECT_MAX_RANGES))
+    {
+        g_test_select.flags = 0;
+        g_test_select.num_include = 0;
+        g_test_select.num_exclude = 0;
+    }
+
+    g_result_dirty = VAL_RESULT_TABLE_SIZE;
+    if ((test_id_prev == VAL_INVALID_TEST_ID)
+        && !(g_test_select.flags & VAL_TEST_SELECT_RERUN_FAILED))
+    {
+        g_result_cnt = 0;
+        return val_nvmem_write(VAL_NVMEM_OFFSET(NV_RESULT_CNT), &g_result_cnt,
+                               sizeof(g_result_cnt));
+    }
+
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_RESULT_CNT), &g_result_cnt,
+                            sizeof(g_result_cnt));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    /* Table never written */
+    if (g_result_cnt > VAL_RESULT_TABLE_SIZE)
+    {
+        g_result_cnt = 0;
+    }
+
+    if (g_result_cnt == 0)
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+    return val_nvmem_read(VAL_NVMEM_OFFSET(NV_RESULT_TABLE), g_test_results,
+                          g_result_cnt * sizeof(test_result_t));
+}
+
+/**
+    @brief    - Looks up the entry of a test in the result table
+    @param    - test_id : Test ID
+    @return   - Index of the entry, or the number of entries if the test has none
+**/
+static uint32_t val_test_result_find(test_id_t test_id)
+{
+    uint32_t        i;
+
+    for (i = 0; i < g_result_cnt; i++)
+    {
+        if (g_test_results[i].test_id == (uint16_t)test_id)
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+/**
+    @brief    - Converts a test time to the elapsed field of the result table
+    @param    - cycles : Test time in cycles
+    @return   - kcycles, or Mcycles with VAL_RESULT_MCYCLES set if the kcycles do not fit
+**/
+static uint16_t val_test_result_elapsed(uint64_t cycles)
+{
+    uint32_t        kcycles = VAL_KCYCLES(cycles);
+
+    if (kcycles < VAL_RESULT_MCYCLES)
+    {
+        return (uint16_t)kcycles;
+    }
+
+    kcycles = (kcycles + 500) / 1000;
+    if (kcycles >= VAL_RESULT_MCYCLES)
+    {
+        kcycles = VAL_RESULT_MCYCLES - 1;
+    }
+    return (uint16_t)(kcycles | VAL_RESULT_MCYCLES);
+}
+
+/**
+    @brief    - Writes the result table entries recorded since the previous write, and
+                the number of entries, to NVMEM
+    @param    - void
+    @return   - error status
+**/
+val_status_t val_test_result_flush(void)
+{
+    val_status_t    status;
+
+    if (g_result_dirty >= g_result_cnt)
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_RESULT_TABLE)
+                             + (g_result_dirty * sizeof(test_result_t)),
+                             &g_test_results[g_result_dirty],
+                             (g_result_cnt - g_result_dirty) * sizeof(test_result_t));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    /* The count goes last, so that a reset in between never exposes unwritten entries */
+    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_RESULT_CNT), &g_result_cnt,
+                             sizeof(g_result_cnt));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    g_result_dirty = VAL_RESULT_TABLE_SIZE;
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Records the result of a test in the result table. The results of the
+                tests which do not fit in the table are only counted, with a warning,
+                and a rerun of the failed tests runs them again. The entry reaches
+                NVMEM with the next boot flag write, see val_set_boot_flag.
+    @param    - test_id : Test ID
+                state   : TEST_PASS, TEST_FAIL, TEST_SKIP or TEST_PENDING
+                status  : Status code of the test
+    @return   - error status
+**/
+static val_status_t val_test_result_record(test_id_t test_id, uint32_t state, uint32_t status)
+{
+    test_result_t       *result;
+    val_test_timing_t   timing;
+    uint32_t            index;
+
+    index = val_test_result_find(test_id);
+    if (index >= VAL_RESULT_TABLE_SIZE)
+    {
+        val_print(PRINT_WARN, "\tResult table full, the result of test %d is not kept\n",
+                  test_id);
+        return VAL_STATUS_SUCCESS;
+    }
+
+    if (index == g_result_cnt)
+    {
+        g_result_cnt++;
+    }
+
+    result = &g_test_results[index];
+    result->test_id    = (uint16_t)test_id;
+    result->state      = (uint8_t)state;
+    result->status     = (uint8_t)status;
+    result->checkpoint = (uint16_t)val_get_test_checkpoint();
+    result->elapsed    = 0;
+    if (val_get_test_timing(&timing) == VAL_STATUS_SUCCESS)
+    {
+        result->elapsed = val_test_result_elapsed(timing.cycles);
+    }
+
+    if (index < g_result_dirty)
+    {
+        g_result_dirty = index;
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Prints the result table
+    @param    - void
+    @return   - void
+**/
+static void val_test_result_dump(void)
+{
+    test_result_t   *result = g_test_results;
+    uint32_t        i;
+
+    if (val_log_result_table(g_test_results, g_result_cnt) == VAL_STATUS_SUCCESS)
+    {
+        return;
+    }
+
+    val_print(PRINT_ALWAYS, "\n************ Result Table ****************\n", 0);
+    for (i = 0; i < g_result_cnt; i++, result++)
+    {
+        val_print(PRINT_ALWAYS, "%d | ", result->test_id);
+        switch (result->state)
+        {
+            case TEST_PASS:
+                val_print(PRINT_ALWAYS, "PASSED   ", 0);
+                break;
+            case TEST_FAIL:
+                val_print(PRINT_ALWAYS, "FAILED   ", 0);
+                break;
+            case TEST_SKIP:
+                val_print(PRINT_ALWAYS, "SKIPPED  ", 0);
+                break;
+            default:
+                val_print(PRINT_ALWAYS, "SIM ERROR", 0);
+                break;
+        }
+        val_print(PRINT_ALWAYS, " | STATUS 0x%x", result->status);
+        val_print(PRINT_ALWAYS, " | CHECKPOINT %d", result->checkpoint);
+        if (result->elapsed & VAL_RESULT_MCYCLES)
+        {
+            val_print(PRINT_ALWAYS, " | %d Mcycles",
+                      result->elapsed & (VAL_RESULT_MCYCLES - 1));
+        }
+        else if (result->elapsed)
+        {
+            val_print(PRINT_ALWAYS, " | %d kcycles", result->elapsed);
+        }
+        val_print(PRINT_ALWAYS, "\n", 0);
+    }
+    val_print(PRINT_ALWAYS, "******************************************\n", 0);
+}
+
+/**
+    @brief    - Checks whether a test is selected to run, by the platform and by the
+                test selection in NVMEM. A rerun of the failed tests also runs the
+                tests which had no room in the full result table.
+    @param    - test_id : Test ID
+    @return   - 1 if the test must run, 0 otherwise
+**/
+static bool_t val_test_selected(test_id_t test_id)
+{
+    test_range_t    *range = g_test_select.range;
+    uint32_t        i, index;
+    bool_t          included = (g_test_select.num_include == 0);
+
+    if (!pal_test_select_ns(test_id))
+    {
+        return 0;
+    }
+
+    for (i = 0; i < g_test_select.num_include; i++, range++)
+    {
+        if ((test_id >= range->first) && (test_id <= range->last))
+        {
+            included = 1;
+        }
+    }
+
+    for (i = 0; i < g_test_select.num_exclude; i++, range++)
+    {
+        if ((test_id >= range->first) && (test_id <= range->last))
+        {
+            return 0;
+        }
+    }
+
+    if (!included)
+    {
+        return 0;
+    }
+
+    if (!(g_test_select.flags & VAL_TEST_SELECT_RERUN_FAILED))
+    {
+        return 1;
+    }
+
+    index = val_test_result_find(test_id);
+    if (index == g_result_cnt)
+    {
+        return (g_result_cnt == VAL_RESULT_TABLE_SIZE);
+    }
+    return ((g_test_results[index].state == TEST_FAIL)
+            || (g_test_results[index].state == TEST_PENDING));
+}
+
 /**
     @brief        - This function reads the test ELFs from RAM or secondary storage and loads into
                     system memory
@@ -129,13 +536,19 @@ int val_copy_elf(uint32_t saddr, uint32_t *info_addr)
 val_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
 {
 #if !defined(TEST_COMBINE_ARCHIVE)
-    test_header_t   test_header;
-    addr_t          flash_addr = combine_test_binary_addr;
+    static uint32_t     dir_checked = 0;
+    static uint32_t     dir_entries = 0;
+    test_header_t       test_header;
+    test_dir_entry_t    dir_entry;
+    addr_t              flash_addr = combine_test_binary_addr;
+    uint32_t            crc;
 
     /*
      * The combined Test ELF binary:
      *
      * ----------------------
+     * | Test Directory     |  (optional)
+     * |--------------------|
      * | Custom Test Header*|
      * |--------------------|
      * | Test-1 Image       |
@@ -153,7 +566,35 @@ val_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
      *
      */
 
-    if (test_id_prev != VAL_INVALID_TEST_ID)
+    if (!dir_checked)
+    {
+        dir_entries = val_test_dir_init();
+        dir_checked = 1;
+    }
+
+    if (dir_entries)
+    {
+        /* Lookup in the test directory, unselected tests are skipped without loading them */
+        do
+        {
+            if (val_test_dir_lookup(test_id_prev, dir_entries, &dir_entry))
+            {
+                val_print(PRINT_ERROR, "Error: reading Test directory\n", 0);
+                return VAL_STATUS_LOAD_ERROR;
+            }
+
+            if (dir_entry.test_id == VAL_INVALID_TEST_ID)
+            {
+                val_print(PRINT_DEBUG, "\n\nNo more valid tests found. Exiting.", 0);
+                *test_id = VAL_INVALID_TEST_ID;
+                return VAL_STATUS_SUCCESS;
+            }
+            test_id_prev = dir_entry.test_id;
+        } while (!val_test_selected(dir_entry.test_id));
+
+        flash_addr += dir_entry.offset;
+    }
+    else if (test_id_prev != VAL_INVALID_TEST_ID)
     {
         /* Jump to last test run + 1 */
         do
@@ -188,27 +629,57 @@ val_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
         } while(1);
     }
 
-    if (val_mem_copy(flash_addr, (uint8_t *)&test_header, sizeof(test_header_t)))
+    do
     {
-        val_print(PRINT_ERROR, "\n\nError: reading custom Test header", 0);
-        return VAL_STATUS_LOAD_ERROR;
-    }
+        if (val_mem_copy(flash_addr, (uint8_t *)&test_header, sizeof(test_header_t)))
+        {
+            val_print(PRINT_ERROR, "\n\nError: reading custom Test header", 0);
+            return VAL_STATUS_LOAD_ERROR;
+        }
 
-    if (test_header.start_marker == VAL_TEST_END_MARKER)
-    {
-        val_print(PRINT_DEBUG, "\n\nNo more valid tests found. Exiting.", 0);
-        *test_id = VAL_INVALID_TEST_ID;
-        return VAL_STATUS_SUCCESS;
-    }
+        if (test_header.start_marker == VAL_TEST_END_MARKER)
+        {
+            val_print(PRINT_DEBUG, "\n\nNo more valid tests found. Exiting.", 0);
+            *test_id = VAL_INVALID_TEST_ID;
+            return VAL_STATUS_SUCCESS;
+        }
 
-    if (test_header.start_marker != VAL_TEST_START_MARKER)
+        if (test_header.start_marker != VAL_TEST_START_MARKER)
+        {
+            val_print(PRINT_ERROR, "\n\nError: No valid test binary found. Exiting.", 0);
+            *test_id = VAL_INVALID_TEST_ID;
+            return VAL_STATUS_LOAD_ERROR;
+        }
+
+        flash_addr += sizeof(test_header_t);
+
+        /* Without a directory, unselected tests are stepped over by their header */
+        if (dir_entries || val_test_selected(test_header.test_id))
+        {
+            break;
+        }
+        flash_addr += test_header.elf_size;
+    } while (1);
+    if (dir_entries)
     {
-        val_print(PRINT_ERROR, "\n\nError: No valid test binary found. Exiting.", 0);
-        *test_id = VAL_INVALID_TEST_ID;
-        return VAL_STATUS_LOAD_ERROR;
+        if (test_header.test_id != dir_entry.test_id)
+        {
+            val_print(PRINT_ERROR, "\n\nError: Test directory mismatch for test %d",
+                                    dir_entry.test_id);
+            return VAL_STATUS_LOAD_ERROR;
+        }
+
+        /* ELF integrity check is only cheap when the image is memory mapped */
+        if (combine_test_binary_in_ram)
+        {
+            if (val_mem_crc32(flash_addr, dir_entry.elf_size, &crc) || (crc != dir_entry.crc32))
+            {
+                val_print(PRINT_ERROR, "\n\nError: CRC mismatch for test %d", dir_entry.test_id);
+                return VAL_STATUS_LOAD_ERROR;
+            }
+        }
     }
 
-    flash_addr += sizeof(test_header_t);
     if (val_copy_elf(flash_addr, &g_test_info_addr))
     {
         val_print(PRINT_ERROR, "Error: loading Test program\n", 0);
@@ -220,37 +691,43 @@ val_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
 
 #else /* TEST_COMBINE_ARCHIVE */
 
-    int             i;
+    int             i = 0;
     val_test_info_t test_list[] = {
 #include "test_entry_list.inc"
                                   {VAL_INVALID_TEST_ID, NULL}
                                   };
 
-    for (i = 0; i < (sizeof(test_list)/sizeof(test_list[0])); i++)
+    if (test_id_prev != VAL_INVALID_TEST_ID)
     {
-        if (test_id_prev == VAL_INVALID_TEST_ID)
-        {
-            *test_id = test_list[i].test_id;
-            g_test_info_addr = (addr_t) test_list[i].entry_addr;
-            return VAL_STATUS_SUCCESS;
-        }
-        else if (test_id_prev == test_list[i].test_id)
+        while ((test_list[i].test_id != VAL_INVALID_TEST_ID)
+               && (test_list[i].test_id != test_id_prev))
         {
-            *test_id = test_list[i+1].test_id;
-            g_test_info_addr = (addr_t) test_list[i+1].entry_addr;
-            return VAL_STATUS_SUCCESS;
+            i++;
         }
-        else if (test_list[i].test_id == VAL_INVALID_TEST_ID)
+
+        if (test_list[i].test_id == VAL_INVALID_TEST_ID)
         {
-            val_print(PRINT_DEBUG, "\n\nNo more valid tests found. Exiting.", 0);
             *test_id = VAL_INVALID_TEST_ID;
-            return VAL_STATUS_SUCCESS;
+            val_print(PRINT_ERROR, "\n\nError: No more valid tests found. Exiting.", 0);
+            return VAL_STATUS_LOAD_ERROR;
         }
+        i++;
     }
 
-    *test_id = VAL_INVALID_TEST_ID;
-    val_print(PRINT_ERROR, "\n\nError: No more valid tests found. Exiting.", 0);
-    return VAL_STATUS_LOAD_ERROR;
+    /* Unselected tests are skipped */
+    while ((test_list[i].test_id != VAL_INVALID_TEST_ID) && !val_test_selected(test_list[i].test_id))
+    {
+        i++;
+    }
+
+    if (test_list[i].test_id == VAL_INVALID_TEST_ID)
+    {
+        val_print(PRINT_DEBUG, "\n\nNo more valid tests found. Exiting.", 0);
+    }
+
+    *test_id = test_list[i].test_id;
+    g_test_info_addr = (addr_t) test_list[i].entry_addr;
+    return VAL_STATUS_SUCCESS;
 #endif /* TEST_COMBINE_ARCHIVE */
 }
 
@@ -304,11 +781,227 @@ char * val_get_comp_name(test_id_t test_id)
             return "Internal Trusted Storage Suite";
         case VAL_INITIAL_ATTESTATION_BASE:
             return "Attestation Suite";
+        case VAL_CRYPTO_PERF_BASE:
+            return "Crypto Performance Suite";
+        case VAL_STORAGE_PERF_BASE:
+            return "Storage Performance Suite";
+        case VAL_IPC_PERF_BASE:
+            return "IPC Performance Suite";
         default:
             return "Unknown Suite";
     }
 }
 
+/**
+    @brief    - Adds the time of the test that just ran to the suite timing summary
+                kept in NVMEM: the total time and the slowest test.
+    @param    - test_id : Test ID
+    @return   - val_status_t
+**/
+static val_status_t val_update_timing_summary(test_id_t test_id)
+{
+    val_test_timing_t    timing;
+    test_id_t            slowest_id;
+    uint32_t             kcycles, total, slowest;
+    val_status_t         status;
+
+    if (val_get_test_timing(&timing) != VAL_STATUS_SUCCESS)
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+    kcycles = VAL_KCYCLES(timing.cycles);
+
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_KCYCLES), &total, sizeof(total));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    total += kcycles;
+    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_KCYCLES), &total, sizeof(total));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_SLOWEST_TEST_ID), &slowest_id, sizeof(test_id_t));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_SLOWEST_KCYCLES), &slowest, sizeof(slowest));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    if ((slowest_id != VAL_INVALID_TEST_ID) && (slowest >= kcycles))
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_SLOWEST_TEST_ID), &test_id, sizeof(test_id_t));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    return val_nvmem_write(VAL_NVMEM_OFFSET(NV_SLOWEST_KCYCLES), &kcycles, sizeof(kcycles));
+}
+
+/**
+    @brief    - Reads the summary of the current suite from NVMEM
+    @param    - summary : Returns the test counts and the timing of the suite
+    @return   - val_status_t
+**/
+static val_status_t val_suite_summary_read(suite_summary_t *summary)
+{
+    val_status_t         status;
+
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_CNT), &summary->count, sizeof(test_count_t));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    /* Timing summary, if any test was timed */
+    summary->kcycles = 0;
+    summary->slowest_kcycles = 0;
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_SLOWEST_TEST_ID), &summary->slowest_id,
+                            sizeof(test_id_t));
+    if (!VAL_ERROR(status) && (summary->slowest_id != VAL_INVALID_TEST_ID))
+    {
+        status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_KCYCLES), &summary->kcycles,
+                                sizeof(summary->kcycles));
+        if (!VAL_ERROR(status))
+        {
+            status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_SLOWEST_KCYCLES),
+                                    &summary->slowest_kcycles, sizeof(summary->slowest_kcycles));
+        }
+    }
+    if (VAL_ERROR(status))
+    {
+        summary->slowest_id = VAL_INVALID_TEST_ID;
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Adds the summary of a suite to the totals of the run
+    @param    - run   : Totals of the run
+                suite : Summary of the suite
+    @return   - void
+**/
+static void val_suite_summary_add(suite_summary_t *run, suite_summary_t *suite)
+{
+    run->count.pass_cnt      += suite->count.pass_cnt;
+    run->count.skip_cnt      += suite->count.skip_cnt;
+    run->count.fail_cnt      += suite->count.fail_cnt;
+    run->count.sim_error_cnt += suite->count.sim_error_cnt;
+    run->kcycles             += suite->kcycles;
+
+    if ((suite->slowest_id != VAL_INVALID_TEST_ID)
+        && ((run->slowest_id == VAL_INVALID_TEST_ID)
+            || (suite->slowest_kcycles > run->slowest_kcycles)))
+    {
+        run->slowest_id = suite->slowest_id;
+        run->slowest_kcycles = suite->slowest_kcycles;
+    }
+}
+
+/**
+    @brief    - Prints the report of a suite, or of all the suites of the run
+    @param    - name    : Suite name
+                summary : Test counts and timing
+    @return   - void
+**/
+static void val_suite_report(char *name, suite_summary_t *summary)
+{
+    test_count_t         *test_count = &summary->count;
+
+    if (val_log_suite_report(name, test_count, summary->slowest_id, summary->kcycles,
+                             summary->slowest_kcycles) == VAL_STATUS_SUCCESS)
+    {
+        return;
+    }
+
+    val_print(PRINT_ALWAYS, "\n************ ", 0);
+    val_print(PRINT_ALWAYS, name, 0);
+    val_print(PRINT_ALWAYS, " Report **********\n", 0);
+    val_print(PRINT_ALWAYS, "TOTAL TESTS     : %d\n", test_count->pass_cnt
+              + test_count->fail_cnt + test_count->skip_cnt + test_count->sim_error_cnt);
+    val_print(PRINT_ALWAYS, "TOTAL PASSED    : %d\n", test_count->pass_cnt);
+    val_print(PRINT_ALWAYS, "TOTAL SIM ERROR : %d\n", test_count->sim_error_cnt);
+    val_print(PRINT_ALWAYS, "TOTAL FAILED    : %d\n", test_count->fail_cnt);
+    val_print(PRINT_ALWAYS, "TOTAL SKIPPED   : %d\n", test_count->skip_cnt);
+    if (summary->slowest_id != VAL_INVALID_TEST_ID)
+    {
+        val_print(PRINT_ALWAYS, "TOTAL KCYCLES   : %d\n", summary->kcycles);
+        val_print(PRINT_ALWAYS, "SLOWEST TEST    : %d", summary->slowest_id);
+        val_print(PRINT_ALWAYS, " (%d kcycles)\n", summary->slowest_kcycles);
+    }
+    val_print(PRINT_ALWAYS, "******************************************\n", 0);
+}
+
+/**
+    @brief    - Ends a suite of a multi-suite image before the tests of the next suite run.
+                Prints the report of the suite, clears the suite summary for the next suite
+                and adds it to the totals of the run. A reset between the two NVMEM writes
+                leaves the suite out of the totals, but never counts it twice.
+    @param    - test_id : ID of the last test of the suite
+    @return   - val_status_t
+**/
+static val_status_t val_suite_end(test_id_t test_id)
+{
+    suite_summary_t      suite, run;
+    val_status_t         status;
+
+    status = val_suite_summary_read(&suite);
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+    val_suite_report(val_get_comp_name(test_id), &suite);
+
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_RUN_CNT), &run, sizeof(suite_summary_t));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    val_suite_summary_add(&run, &suite);
+
+    suite.count.pass_cnt = 0;
+    suite.count.skip_cnt = 0;
+    suite.count.fail_cnt = 0;
+    suite.count.sim_error_cnt = 0;
+    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_CNT), &suite.count, sizeof(test_count_t));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    suite.kcycles = 0;
+    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_KCYCLES), &suite.kcycles,
+                             sizeof(suite.kcycles));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    suite.slowest_id = VAL_INVALID_TEST_ID;
+    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_SLOWEST_TEST_ID), &suite.slowest_id,
+                             sizeof(test_id_t));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    /* The totals are outside the NVMEM shadow, writing them commits the cleared summary */
+    return val_nvmem_write(VAL_NVMEM_OFFSET(NV_RUN_CNT), &run, sizeof(suite_summary_t));
+}
+
 /**
     @brief    - This function is responsible for setting up VAL infrastructure.
                 Loads test one by one from combine binary and calls test_entry
@@ -324,6 +1017,7 @@ void val_dispatcher(test_id_t test_id_prev)
     boot_t               boot;
     test_count_t         test_count;
     uint32_t             test_result;
+    suite_summary_t      suite, run;
 
     status = val_target_get_config(TARGET_CONFIG_CREATE_ID(GROUP_MISCELLANEOUS,
                                     MISCELLANEOUS_DUT, 0),
@@ -337,6 +1031,49 @@ void val_dispatcher(test_id_t test_id_prev)
 
     combine_test_binary_addr   = misc_desc->ns_start_addr_of_combine_test_binary;
     combine_test_binary_in_ram = misc_desc->combine_test_binary_in_ram;
+
+    status = val_test_select_init(test_id_prev);
+    if (VAL_ERROR(status))
+    {
+        val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
+        return;
+    }
+
+    status = val_wd_profile_init(g_test_select.flags & VAL_TEST_SELECT_WD_CALIBRATE);
+    if (VAL_ERROR(status) && (status != VAL_STATUS_UNSUPPORTED))
+    {
+        val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
+        return;
+    }
+
+    if (test_id_prev == VAL_INVALID_TEST_ID)
+    {
+        /* No suite reported yet */
+        memset(&run, 0, sizeof(suite_summary_t));
+        run.slowest_id = VAL_INVALID_TEST_ID;
+        status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_RUN_CNT), &run, sizeof(suite_summary_t));
+        if (VAL_ERROR(status))
+        {
+            val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
+            return;
+        }
+
+        if (g_test_select.flags & VAL_TEST_SELECT_WD_CALIBRATE)
+        {
+            val_print(PRINT_ALWAYS, (status == VAL_STATUS_UNSUPPORTED)
+                      ? "\nNo cycle counter to calibrate the watchdog timeouts\n"
+                      : "\nCalibrating the watchdog timeouts\n", 0);
+        }
+
+        if (g_test_select.flags & VAL_TEST_SELECT_RERUN_FAILED)
+        {
+            val_print(PRINT_ALWAYS, "\nRunning the tests which failed in the previous run\n", 0);
+        }
+        else if (g_test_select.num_include || g_test_select.num_exclude)
+        {
+            val_print(PRINT_ALWAYS, "\nRunning the selected tests\n", 0);
+        }
+    }
     do
     {
         status = val_get_boot_flag(&boot.state);
@@ -377,8 +1114,8 @@ void val_dispatcher(test_id_t test_id_prev)
         }
         else
         {
+            /* Unselected tests are neither run nor counted */
             status = val_test_load(&test_id, test_id_prev);
-
             if (VAL_ERROR(status))
             {
                 return;
@@ -398,6 +1135,17 @@ void val_dispatcher(test_id_t test_id_prev)
 
             if (VAL_GET_COMP_NUM(test_id_prev) != VAL_GET_COMP_NUM(test_id))
             {
+                /* Report of the previous suite of a multi-suite image */
+                if (test_id_prev != VAL_INVALID_TEST_ID)
+                {
+                    status = val_suite_end(test_id_prev);
+                    if (VAL_ERROR(status))
+                    {
+                        val_print(PRINT_ERROR, "\n\tNVMEM error", 0);
+                        return;
+                    }
+                }
+
                 val_print(PRINT_ALWAYS, "\nRunning.. ", 0);
                 val_print(PRINT_ALWAYS, val_get_comp_name(test_id), 0);
                 val_print(PRINT_ALWAYS, "\n******************************************\n", 0);
@@ -412,18 +1160,21 @@ void val_dispatcher(test_id_t test_id_prev)
                     return;
                 }
             }
+            else
+            {
+                /* Commit the current test id before the test runs */
+                status = val_nvmem_sync();
+                if (VAL_ERROR(status))
+                {
+                    val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
+                    return;
+                }
+            }
             val_execute_test_fn();
         }
 
         test_result = val_report_status();
 
-        /* Reset boot.state to UNKNOWN before lunching next test */
-        status = val_set_boot_flag(BOOT_UNKNOWN);
-        if (VAL_ERROR(status))
-        {
-            return;
-        }
-
         /* Prepare suite summary data structure */
         status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
         if (VAL_ERROR(status))
@@ -455,6 +1206,20 @@ void val_dispatcher(test_id_t test_id_prev)
             return;
         }
 
+        status = val_test_result_record(test_id, test_result, val_get_status() & TEST_STATUS_MASK);
+        if (VAL_ERROR(status))
+        {
+            val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
+            return;
+        }
+
+        status = val_update_timing_summary(test_id);
+        if (VAL_ERROR(status))
+        {
+            val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
+            return;
+        }
+
         test_id_prev = test_id;
         status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_ID_PREVIOUS),
                                  &test_id, sizeof(test_id_t));
@@ -464,25 +1229,41 @@ void val_dispatcher(test_id_t test_id_prev)
             return;
         }
 
+        /* Reset boot.state to UNKNOWN before lunching next test. This also commits
+           the above summary data to NVMEM */
+        status = val_set_boot_flag(BOOT_UNKNOWN);
+        if (VAL_ERROR(status))
+        {
+            return;
+        }
+
    } while(1);
 
-   status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
+   status = val_test_result_flush();
+   if (VAL_ERROR(status))
+   {
+       val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
+       return;
+   }
+
+   status = val_suite_summary_read(&suite);
    if (VAL_ERROR(status))
    {
        val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
        return;
    }
+   val_suite_report(val_get_comp_name(test_id_prev), &suite);
+
+   /* Totals of a multi-suite image, with the suites reported before the last one */
+   status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_RUN_CNT), &run, sizeof(suite_summary_t));
+   if (!VAL_ERROR(status) && (run.count.pass_cnt || run.count.skip_cnt || run.count.fail_cnt
+                              || run.count.sim_error_cnt))
+   {
+       val_suite_summary_add(&run, &suite);
+       val_suite_report("All Suites", &run);
+   }
 
-   val_print(PRINT_ALWAYS, "\n************ ", 0);
-   val_print(PRINT_ALWAYS, val_get_comp_name(test_id_prev), 0);
-   val_print(PRINT_ALWAYS, " Report **********\n", 0);
-   val_print(PRINT_ALWAYS, "TOTAL TESTS     : %d\n", test_count.pass_cnt + test_count.fail_cnt
-            + test_count.skip_cnt + test_count.sim_error_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL PASSED    : %d\n", test_count.pass_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL SIM ERROR : %d\n", test_count.sim_error_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL FAILED    : %d\n", test_count.fail_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL SKIPPED   : %d\n", test_count.skip_cnt);
-   val_print(PRINT_ALWAYS, "******************************************\n", 0);
+   val_test_result_dump();
 }
 
 
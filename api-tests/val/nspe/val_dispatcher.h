@@ -24,6 +24,8 @@
 #define VAL_INVALID_TEST_ID            0xffffffff
 #define VAL_TEST_START_MARKER          0xfaceface
 #define VAL_TEST_END_MARKER            0xc3c3c3c3
+#define VAL_TEST_DIR_MARKER            0xd1ec7047
+#define VAL_TEST_DIR_VERSION           1
 
 /* typedef's */
 typedef uint32_t  elf32_word;
@@ -66,5 +68,66 @@ typedef struct {
     uint32_t  elf_size;
 } test_header_t;
 
+/* Directory placed at the start of combine_test_binary by combine_test_binary.py */
+typedef struct {
+    uint32_t  marker;
+    uint32_t  version;
+    uint32_t  num_entries;
+    uint32_t  crc32;            /* CRC32 of the entry table */
+} test_dir_header_t;
+
+/* Directory entries are sorted by test_id */
+typedef struct {
+    test_id_t test_id;
+    uint32_t  offset;           /* Offset of the custom test header from image start */
+    uint32_t  elf_size;
+    uint32_t  crc32;            /* CRC32 of the test ELF */
+} test_dir_entry_t;
+
+#define VAL_TEST_SELECT_MAGIC          0x4c455354  /* "TSEL" */
+#define VAL_TEST_SELECT_MAX_RANGES     6
+#define VAL_TEST_SELECT_RERUN_FAILED   0x1
+#define VAL_TEST_SELECT_WD_CALIBRATE   0x2     /* Record the watchdog timeout profile */
+#define VAL_RESULT_TABLE_SIZE          96
+#define VAL_RESULT_MCYCLES             0x8000  /* test_result_t.elapsed is in Mcycles */
+
+/* Test ID range, both ends included */
+typedef struct {
+    uint16_t  first;
+    uint16_t  last;
+} test_range_t;
+
+/* Test selection kept in NVMEM at NV_TEST_SELECT, written by tools/scripts/test_select.py
+ * or a debugger. A test runs if it is in one of the include ranges, or there are none,
+ * and in none of the exclude ranges. With VAL_TEST_SELECT_RERUN_FAILED, only the tests
+ * that failed or had a SIM ERROR in the result table run, and the table is kept. */
+typedef struct {
+    uint32_t      magic;
+    uint16_t      flags;
+    uint8_t       num_include;
+    uint8_t       num_exclude;
+    test_range_t  range[VAL_TEST_SELECT_MAX_RANGES]; /* Include ranges, then exclude ranges */
+} test_select_t;
+
+/* Entry of the result table kept in NVMEM at NV_RESULT_TABLE, one per test run.
+ * The entries recorded since the previous boot flag write are written with the next one. */
+typedef struct {
+    uint16_t  test_id;
+    uint8_t   state;            /* TEST_PASS, TEST_FAIL, TEST_SKIP or TEST_PENDING */
+    uint8_t   status;
+    uint16_t  checkpoint;       /* Last checkpoint reached or failed */
+    uint16_t  elapsed;          /* kcycles, or Mcycles with VAL_RESULT_MCYCLES. 0 if not timed */
+} test_result_t;
+
+/* Test counts and timing of a suite. The totals of the suites which ran before the current
+ * one in a multi-suite image are kept in NVMEM from NV_RUN_CNT on. */
+typedef struct {
+    test_count_t  count;
+    uint32_t      kcycles;          /* Time of the timed tests */
+    test_id_t     slowest_id;       /* VAL_INVALID_TEST_ID if no test was timed */
+    uint32_t      slowest_kcycles;
+} suite_summary_t;
+
 void val_dispatcher(test_id_t);
+val_status_t val_test_result_flush(void);
 #endif
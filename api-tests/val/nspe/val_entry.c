@@ -52,6 +52,7 @@ void val_entry(void)
 
 exit:
     val_print(PRINT_ALWAYS, "\nEntering standby.. \n", 0);
+    val_print_flush();
 
     pal_terminate_simulation();
 }
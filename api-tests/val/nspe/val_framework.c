@@ -21,12 +21,54 @@
 #include "val_peripherals.h"
 #include "pal_interfaces_ns.h"
 #include "val_target.h"
+#include "val_log.h"
 
 extern val_api_t val_api;
 extern psa_api_t psa_api;
 
 /* globals */
 test_status_buffer_t    g_status_buffer;
+static val_test_timing_t g_test_timing;
+static uint32_t          g_test_checkpoint;
+
+/**
+    @brief    - Starts the timing of the current test. Timing stays off if the
+                platform has no cycle counter, or one without a known rate, which
+                may not count correctly over the length of a test.
+    @return   - void
+**/
+static void val_test_timing_start(void)
+{
+    uint32_t    freq_hz;
+
+    g_test_timing.state = TIMING_IDLE;
+    if (VAL_ERROR(val_cycle_counter_init(&freq_hz)) || (freq_hz == 0))
+    {
+        return;
+    }
+
+    g_test_timing.cycles           = 0;
+    g_test_timing.max_check_cycles = 0;
+    g_test_timing.max_checkpoint   = 0;
+    g_test_timing.checkpoints      = 0;
+    g_test_timing.state            = TIMING_RUNNING;
+    g_test_timing.last             = val_cycle_counter_read();
+}
+
+/**
+    @brief    - Adds the cycles since the previous sample to the test time
+    @return   - Cycles since the previous sample
+**/
+static uint32_t val_test_timing_sample(void)
+{
+    uint32_t    now, cycles;
+
+    now = val_cycle_counter_read();
+    cycles = now - g_test_timing.last;
+    g_test_timing.last = now;
+    g_test_timing.cycles += cycles;
+    return cycles;
+}
 
 /**
  * @brief Connect to given sid
@@ -87,9 +129,10 @@ void val_ipc_close(psa_handle_t handle)
 /**
     @brief    - This function executes given list of tests from non-secure sequentially
                 This covers non-secure to secure IPC API scenario
-    @param    - test_num   : Test_num
+    @param    - test_num   : Test ID, the partitions are given its number within the suite
     @param    - tests_list : list of tests to be executed
-    @param    - server_hs  : Initiate a server handshake
+    @param    - server_hs  : Initiate a server handshake. One connection to the server
+                             dispatcher carries the handshakes of all the check blocks.
     @return   - val_status_t
 **/
 val_status_t val_execute_non_secure_tests(uint32_t test_num, client_test_t *tests_list,
@@ -98,11 +141,11 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, client_test_t *test
     val_status_t          status = VAL_STATUS_SUCCESS;
     val_status_t          test_status = VAL_STATUS_SUCCESS;
     boot_t                boot;
-    psa_handle_t          handle;
+    psa_handle_t          handle = PSA_NULL_HANDLE;
     uint32_t              i = 1;
     test_info_t           test_info;
 
-    test_info.test_num = test_num;
+    test_info.test_num = VAL_GET_TEST_NUM(test_num);
 
     status = val_get_boot_flag(&boot.state);
     if (VAL_ERROR(status))
@@ -133,7 +176,7 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, client_test_t *test
                 status = val_set_boot_flag(BOOT_NOT_EXPECTED);
                 if (VAL_ERROR(status))
                 {
-                    return status;
+                    break;
                 }
             }
 
@@ -150,7 +193,7 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, client_test_t *test
                 {
                     val_set_status(RESULT_FAIL(status));
                     val_print(PRINT_DEBUG,"[Check%d] START\n", i);
-                    return status;
+                    break;
                 }
                 else
                 {
@@ -173,15 +216,14 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, client_test_t *test
                 val_set_status(status);
                 if (server_hs == TRUE)
                     val_print(PRINT_DEBUG, "[Check%d] SKIPPED\n", i);
-                return status;
+                break;
             }
             else if (VAL_ERROR(status))
             {
                 val_set_status(RESULT_FAIL(status));
                 if (server_hs == TRUE)
                     val_print(PRINT_DEBUG, "[Check%d] FAILED\n", i);
-
-                return status;
+                break;
             }
             else
             {
@@ -191,6 +233,9 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, client_test_t *test
 
             i++;
         }
+
+        /* End of the server dispatcher session */
+        val_close_secure_test_session(&handle);
    }
    else
    {
@@ -207,17 +252,17 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, client_test_t *test
     @brief    - This function is used to switch to client_partition.c
                 where client tests will be executed to cover secure to secure
                 IPC scenario.
-    @param    - test_num  : Test_num
+    @param    - test_num  : Test ID, the partitions are given its number within the suite
     @return   - val_status_t
 **/
 val_status_t val_switch_to_secure_client(uint32_t test_num)
 {
     val_status_t          status = VAL_STATUS_SUCCESS;
     boot_t                boot;
-    psa_handle_t          handle;
+    psa_handle_t          handle = PSA_NULL_HANDLE;
     test_info_t           test_info;
 
-    test_info.test_num = test_num;
+    test_info.test_num = VAL_GET_TEST_NUM(test_num);
     test_info.block_num = 1;
 
     status = val_get_boot_flag(&boot.state);
@@ -254,6 +299,7 @@ val_status_t val_switch_to_secure_client(uint32_t test_num)
 
        /* Retrive secure client test status */
        status = val_get_secure_test_result(&handle);
+       val_close_secure_test_session(&handle);
        if (IS_TEST_SKIP(status))
        {
             val_set_status(status);
@@ -282,7 +328,9 @@ exit:
                 - nonsecure client fn to server test fn
                 - secure client fn and server test fn
                 - nonsecure client fn to secure client test fn
-    @param    - handle     : handle returned while connecting given sid
+                The dispatcher is connected on the first handshake, the following ones
+                reuse the connection until val_close_secure_test_session.
+    @param    - handle     : handle of the dispatcher connection, PSA_NULL_HANDLE if none
     @param    - test_info  : Test_num and block_num to be executed
     @param    - sid        : RoT service to be connected. Partition dispatcher sid
     @return   - val_status_t
@@ -293,11 +341,15 @@ val_status_t val_execute_secure_test_func(psa_handle_t *handle, test_info_t test
     val_status_t    status = VAL_STATUS_SUCCESS;
     psa_status_t    status_of_call = PSA_SUCCESS;
 
-    *handle = pal_ipc_connect(sid, 0);
-    if (*handle < 0)
+    if (*handle == PSA_NULL_HANDLE)
     {
-        val_print(PRINT_ERROR, "Could not connect SID. Handle=%x\n", *handle);
-        return VAL_STATUS_CONNECTION_FAILED;
+        *handle = pal_ipc_connect(sid, 0);
+        if (*handle < 0)
+        {
+            val_print(PRINT_ERROR, "Could not connect SID. Handle=%x\n", *handle);
+            *handle = PSA_NULL_HANDLE;
+            return VAL_STATUS_CONNECTION_FAILED;
+        }
     }
 
     test_data = ((uint32_t)(test_info.test_num) |((uint32_t)(test_info.block_num) << BLOCK_NUM_POS)
@@ -309,7 +361,7 @@ val_status_t val_execute_secure_test_func(psa_handle_t *handle, test_info_t test
     {
         status = VAL_STATUS_CALL_FAILED;
         val_print(PRINT_ERROR, "Call to dispatch SF failed. Status=%x\n", status_of_call);
-        pal_ipc_close(*handle);
+        val_close_secure_test_session(handle);
     }
 
     return status;
@@ -317,7 +369,7 @@ val_status_t val_execute_secure_test_func(psa_handle_t *handle, test_info_t test
 
 /**
     @brief    - This function is used to retrive the status of previously connected test function
-                using val_execute_secure_test_func
+                using val_execute_secure_test_func. The connection is kept for the next one.
     @param    - handle     : handle of server function. Handle of Partition dispatcher sid
     @return   - The status of test functions
 **/
@@ -339,10 +391,23 @@ val_status_t val_get_secure_test_result(psa_handle_t *handle)
         val_print(PRINT_ERROR, "Call to dispatch SF failed. Status=%x\n", status_of_call);
     }
 
-    pal_ipc_close(*handle);
     return status;
 }
 
+/**
+    @brief    - Closes the dispatcher connection of val_execute_secure_test_func, which
+                ends the session of the test with the partition
+    @param    - handle     : handle of the dispatcher connection, set to PSA_NULL_HANDLE
+    @return   - void
+**/
+void val_close_secure_test_session(psa_handle_t *handle)
+{
+    if (*handle != PSA_NULL_HANDLE)
+    {
+        pal_ipc_close(*handle);
+        *handle = PSA_NULL_HANDLE;
+    }
+}
 
 /**
     @brief    - Parses input status for a given test and
@@ -352,46 +417,75 @@ val_status_t val_get_secure_test_result(psa_handle_t *handle)
 uint32_t val_report_status(void)
 {
     uint32_t status, state;
+    bool_t   logged;
 
     status = val_get_status();
 
     state = (status >> TEST_STATE_BIT) & TEST_STATE_MASK;
     status = status & TEST_STATUS_MASK;
 
+    /* The decoder of the binary log prints the result and timing from the record */
+    logged = (val_log_test_end(state, status, (g_test_timing.state == TIMING_DONE)
+                               ? &g_test_timing : NULL) == VAL_STATUS_SUCCESS);
+
     switch (state)
     {
         case TEST_START:
             state = TEST_FAIL;
-            val_print(PRINT_ALWAYS, "TEST RESULT: FAILED (Error Code=0x%x)\n",
+            if (!logged)
+                val_print(PRINT_ALWAYS, "TEST RESULT: FAILED (Error Code=0x%x)\n",
                                                     VAL_STATUS_INIT_FAILED);
             break;
 
         case TEST_END:
             state = TEST_PASS;
-            val_print(PRINT_ALWAYS, "TEST RESULT: PASSED \n", 0);
+            if (!logged)
+                val_print(PRINT_ALWAYS, "TEST RESULT: PASSED \n", 0);
             break;
 
         case TEST_FAIL:
-            val_print(PRINT_ALWAYS, "TEST RESULT: FAILED (Error Code=0x%x) \n", status);
+            if (!logged)
+                val_print(PRINT_ALWAYS, "TEST RESULT: FAILED (Error Code=0x%x) \n", status);
             break;
 
         case TEST_SKIP:
             state = TEST_SKIP;
-            val_print(PRINT_ALWAYS, "TEST RESULT: SKIPPED (Skip Code=0x%x)\n", status);
+            if (!logged)
+                val_print(PRINT_ALWAYS, "TEST RESULT: SKIPPED (Skip Code=0x%x)\n", status);
             break;
 
         case TEST_PENDING:
-            val_print(PRINT_ALWAYS, "TEST RESULT: SIM ERROR (Error Code=0x%x)\n", status);
+            if (!logged)
+                val_print(PRINT_ALWAYS, "TEST RESULT: SIM ERROR (Error Code=0x%x)\n", status);
             break;
 
         default:
             state = TEST_FAIL;
-            val_print(PRINT_ALWAYS, "TEST RESULT: FAILED(Error Code=0x%x)\n", VAL_STATUS_INVALID);
+            if (!logged)
+                val_print(PRINT_ALWAYS, "TEST RESULT: FAILED(Error Code=0x%x)\n", VAL_STATUS_INVALID);
             break;
 
     }
 
+    if (logged)
+    {
+        val_print_flush();
+        return state;
+    }
+
+    if (g_test_timing.state == TIMING_DONE)
+    {
+        val_print(PRINT_ALWAYS, "TEST TIMING: %d kcycles", VAL_KCYCLES(g_test_timing.cycles));
+        if (g_test_timing.checkpoints)
+        {
+            val_print(PRINT_ALWAYS, ", slowest checkpoint %d", g_test_timing.max_checkpoint);
+            val_print(PRINT_ALWAYS, " (%d cycles)", g_test_timing.max_check_cycles);
+        }
+        val_print(PRINT_ALWAYS, "\n", 0);
+    }
+
     val_print(PRINT_ALWAYS, "\n******************************************\n", 0);
+    val_print_flush();
     return state;
 }
 
@@ -431,6 +525,7 @@ val_status_t val_err_check_set(uint32_t checkpoint, val_status_t status)
         val_print(PRINT_ERROR, "\tCheckpoint %d : ", checkpoint);
         val_print(PRINT_ERROR, "Error Code=0x%x \n", status);
         val_set_status(RESULT_FAIL(status));
+        g_test_checkpoint = checkpoint;
     }
     else
     {
@@ -443,11 +538,80 @@ val_status_t val_err_check_set(uint32_t checkpoint, val_status_t status)
         else
         {
             val_print(PRINT_DEBUG, "\tCheckpoint %d \n", checkpoint);
+            val_test_checkpoint(checkpoint);
         }
     }
     return status;
 }
 
+/**
+    @brief    - Records the time taken to reach the given checkpoint since the
+                previous checkpoint, or since the test start.
+    @param    - checkpoint : Test debug checkpoint
+    @return   - void
+**/
+void val_test_checkpoint(uint32_t checkpoint)
+{
+    uint32_t    cycles;
+
+    g_test_checkpoint = checkpoint;
+    if (g_test_timing.state != TIMING_RUNNING)
+    {
+        return;
+    }
+
+    cycles = val_test_timing_sample();
+    g_test_timing.checkpoints++;
+    if (cycles > g_test_timing.max_check_cycles)
+    {
+        g_test_timing.max_check_cycles = cycles;
+        g_test_timing.max_checkpoint   = checkpoint;
+    }
+
+    if (val_log_checkpoint(checkpoint, cycles) != VAL_STATUS_SUCCESS)
+    {
+        val_print(PRINT_INFO, "\t[Timing] Checkpoint %d", checkpoint);
+        val_print(PRINT_INFO, " : %d cycles\n", cycles);
+    }
+}
+
+/**
+    @brief    - Records the checkpoint at which the current test failed
+    @param    - checkpoint : Test debug checkpoint
+    @return   - void
+**/
+void val_test_checkpoint_failed(uint32_t checkpoint)
+{
+    g_test_checkpoint = checkpoint;
+}
+
+/**
+    @brief    - Returns the timing of the last test that ran to val_test_exit
+    @param    - timing : Returns the timing record
+    @return   - val_status_t, VAL_STATUS_NOT_FOUND if the test was not timed
+**/
+val_status_t val_get_test_timing(val_test_timing_t *timing)
+{
+    if (g_test_timing.state != TIMING_DONE)
+    {
+        return VAL_STATUS_NOT_FOUND;
+    }
+
+    *timing = g_test_timing;
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Returns the checkpoint at which the current test failed, or else the
+                last checkpoint it reached
+    @param    - void
+    @return   - Checkpoint, 0 if none was reached
+**/
+uint32_t val_get_test_checkpoint(void)
+{
+    return g_test_checkpoint;
+}
+
 /**
   @brief  This API prints the test number, description and
           sets the test state to TEST_START on successful execution.
@@ -467,9 +631,14 @@ void val_test_init(uint32_t test_num, char8_t *desc, uint32_t test_bitfield)
    /*global init*/
    g_status_buffer.state   = TEST_FAIL;
    g_status_buffer.status  = VAL_STATUS_INVALID;
+   g_test_timing.state     = TIMING_IDLE;
+   g_test_checkpoint       = 0;
 
-   val_print(PRINT_ALWAYS, "\nTEST: %d | DESCRIPTION: ", test_num);
-   val_print(PRINT_ALWAYS, desc, 0);
+   if (val_log_test_start(test_num, desc) != VAL_STATUS_SUCCESS)
+   {
+       val_print(PRINT_ALWAYS, "\nTEST: %d | DESCRIPTION: ", test_num);
+       val_print(PRINT_ALWAYS, desc, 0);
+   }
 
    /* common skip logic */
    status = val_target_get_config(TARGET_CONFIG_CREATE_ID(GROUP_MISCELLANEOUS,
@@ -492,6 +661,7 @@ void val_test_init(uint32_t test_num, char8_t *desc, uint32_t test_bitfield)
 
 #ifdef WATCHDOG_AVAILABLE
    /* Initialise watchdog */
+   val_wd_profile_start(test_num);
    status = val_wd_timer_init(GET_WD_TIMOUT_TYPE(test_bitfield));
    if (VAL_ERROR(status))
    {
@@ -508,6 +678,7 @@ void val_test_init(uint32_t test_num, char8_t *desc, uint32_t test_bitfield)
    }
 #endif
 
+   val_test_timing_start();
    val_set_status(RESULT_START(VAL_STATUS_SUCCESS));
    return;
 }
@@ -522,6 +693,12 @@ void val_test_exit(void)
 {
     val_status_t         status = VAL_STATUS_SUCCESS;
 
+    if (g_test_timing.state == TIMING_RUNNING)
+    {
+        val_test_timing_sample();
+        g_test_timing.state = TIMING_DONE;
+    }
+
 #ifdef WATCHDOG_AVAILABLE
     status = val_wd_timer_disable();
     if (VAL_ERROR(status))
@@ -530,6 +707,15 @@ void val_test_exit(void)
        val_set_status(RESULT_FAIL(status));
        return;
     }
+
+    status = val_get_status();
+    status = val_wd_profile_end(!IS_TEST_FAIL(status) && !IS_TEST_SKIP(status));
+    if (VAL_ERROR(status))
+    {
+       val_print(PRINT_ERROR, "\tval_wd_profile_end failed Error=0x%x\n", status);
+       val_set_status(RESULT_FAIL(status));
+       return;
+    }
 #endif
 
     status = val_get_status();
@@ -555,6 +741,7 @@ val_status_t val_get_last_run_test_id(test_id_t *test_id)
     val_status_t    status;
     test_count_t    test_count;
     boot_t          boot;
+    uint32_t        kcycles;
     int             i = 0, intermediate_boot = 0;
     boot_state_t    boot_state[] = {BOOT_NOT_EXPECTED,
                                     BOOT_EXPECTED_NS,
@@ -584,12 +771,6 @@ val_status_t val_get_last_run_test_id(test_id_t *test_id)
     if (!intermediate_boot)
     {
          /* First boot. Initiliase necessary data structure */
-         status = val_set_boot_flag(BOOT_UNKNOWN);
-         if (VAL_ERROR(status))
-         {
-             return status;
-         }
-
          *test_id = VAL_INVALID_TEST_ID;
          status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_ID_PREVIOUS),
                                   test_id, sizeof(test_id_t));
@@ -611,6 +792,30 @@ val_status_t val_get_last_run_test_id(test_id_t *test_id)
              val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
              return status;
          }
+
+         /* No test timed yet */
+         kcycles = 0;
+         status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_KCYCLES), &kcycles, sizeof(kcycles));
+         if (VAL_ERROR(status))
+         {
+             val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
+             return status;
+         }
+
+         status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_SLOWEST_TEST_ID),
+                                  test_id, sizeof(test_id_t));
+         if (VAL_ERROR(status))
+         {
+             val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
+             return status;
+         }
+
+         /* Commits the above data structure along with the boot flag */
+         status = val_set_boot_flag(BOOT_UNKNOWN);
+         if (VAL_ERROR(status))
+         {
+             return status;
+         }
     }
 
     status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_ID_PREVIOUS), test_id, sizeof(test_id_t));
@@ -634,6 +839,15 @@ val_status_t val_set_boot_flag(boot_state_t state)
    boot_t           boot;
    val_status_t     status;
 
+   /* The results still held in RAM would be lost by a reset, expected or not, so they
+      go to NVMEM ahead of the boot flag */
+   status = val_test_result_flush();
+   if (VAL_ERROR(status))
+   {
+       val_print(PRINT_ERROR, "\tval_test_result_flush failed. Error=0x%x\n", status);
+       return status;
+   }
+
    boot.state = state;
    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_BOOT), &boot, sizeof(boot_t));
    if (VAL_ERROR(status))
@@ -641,6 +855,21 @@ val_status_t val_set_boot_flag(boot_state_t state)
        val_print(PRINT_ERROR, "\tval_nvmem_write failed. Error=0x%x\n", status);
        return status;
    }
+
+   /* Boot flag must be in NVMEM before anything can reset the system. This also
+      commits the other pending NVMEM writes */
+   status = val_nvmem_sync();
+   if (VAL_ERROR(status))
+   {
+       val_print(PRINT_ERROR, "\tval_nvmem_sync failed. Error=0x%x\n", status);
+       return status;
+   }
+
+   /* The prints still queued for the UART would be lost by the reset the test expects */
+   if ((state != BOOT_UNKNOWN) && (state != BOOT_NOT_EXPECTED))
+   {
+       val_print_flush();
+   }
    return status;
 }
 
@@ -663,3 +892,387 @@ val_status_t val_get_boot_flag(boot_state_t *state)
    *state = boot.state;
    return status;
 }
+
+/**
+    @brief    - Measures the cycles taken by an operation. The operation is run once to
+                size the batch, then repeatedly for about VAL_PERF_WINDOW_DIV'th of a
+                second, or VAL_PERF_WINDOW_CYCLES if the counter rate is not known.
+    @param    - fn      : Operation to measure
+                ctx     : Argument passed to the operation
+                result  : Returns the number of iterations and the cycles they took
+    @return   - val_status_t
+**/
+val_status_t val_perf_measure(val_perf_fn_t fn, void *ctx, val_perf_result_t *result)
+{
+    uint32_t        window, start, cycles, i;
+    val_status_t    status;
+
+    status = val_cycle_counter_init(&result->freq_hz);
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    window = result->freq_hz ? (result->freq_hz / VAL_PERF_WINDOW_DIV) : VAL_PERF_WINDOW_CYCLES;
+
+    /* The first run also warms up caches and lazily set up state */
+    start = val_cycle_counter_read();
+    if (fn(ctx))
+    {
+        return VAL_STATUS_ERROR;
+    }
+    cycles = val_cycle_counter_read() - start;
+
+    if (cycles == 0)
+    {
+        result->iterations = VAL_PERF_MAX_ITERATIONS;
+    }
+    else
+    {
+        result->iterations = (cycles < window) ? (window / cycles) : 1;
+        if (result->iterations > VAL_PERF_MAX_ITERATIONS)
+        {
+            result->iterations = VAL_PERF_MAX_ITERATIONS;
+        }
+    }
+
+    start = val_cycle_counter_read();
+    for (i = 0; i < result->iterations; i++)
+    {
+        if (fn(ctx))
+        {
+            return VAL_STATUS_ERROR;
+        }
+    }
+    result->cycles = val_cycle_counter_read() - start;
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Prints a performance measurement as a single line of space separated
+                key=value pairs:
+                [Perf] op=<name> alg=<hex> size=<bytes> iterations= cycles= cycles_per_op=
+                followed by ops_per_sec= and kbytes_per_sec= if the counter rate is known.
+    @param    - op      : Name of the measured operation
+                alg     : Algorithm or other identifier of the operation variant
+                size    : Number of bytes processed by one operation, 0 if not applicable
+                result  : Measurement from val_perf_measure
+    @return   - void
+**/
+void val_perf_report(char *op, uint32_t alg, uint32_t size, val_perf_result_t *result)
+{
+    uint64_t        ops_per_sec;
+
+    val_print(PRINT_ALWAYS, "[Perf] op=", 0);
+    val_print(PRINT_ALWAYS, op, 0);
+    val_print(PRINT_ALWAYS, " alg=0x%x", alg);
+    val_print(PRINT_ALWAYS, " size=%d", size);
+    val_print(PRINT_ALWAYS, " iterations=%d", result->iterations);
+    val_print(PRINT_ALWAYS, " cycles=%d", result->cycles);
+    val_print(PRINT_ALWAYS, " cycles_per_op=%d", result->cycles / result->iterations);
+
+    if (result->freq_hz && result->cycles)
+    {
+        ops_per_sec = ((uint64_t)result->iterations * result->freq_hz) / result->cycles;
+        val_print(PRINT_ALWAYS, " ops_per_sec=%d", (int32_t)ops_per_sec);
+        if (size)
+        {
+            val_print(PRINT_ALWAYS, " kbytes_per_sec=%d",
+                      (int32_t)(((uint64_t)result->iterations * size * result->freq_hz)
+                                / result->cycles / 1024));
+        }
+    }
+    val_print(PRINT_ALWAYS, "\n", 0);
+}
+
+/**
+    @brief    - Measures the latency of an operation which changes state, such as a
+                storage write. Each run of the operation is timed on its own, so that
+                the slow runs are seen and not only the mean. The optional setup
+                operation runs before each timed run and is not timed.
+    @param    - setup   : Operation restoring the state for the next run, or NULL
+                fn      : Operation to measure
+                ctx     : Argument passed to both operations
+                count   : Number of runs, up to VAL_PERF_MAX_SAMPLES
+                result  : Returns the mean, 99th percentile and largest cycles per run
+    @return   - val_status_t
+**/
+val_status_t val_perf_measure_latency(val_perf_fn_t setup, val_perf_fn_t fn, void *ctx,
+                                      uint32_t count, val_perf_latency_t *result)
+{
+    static uint32_t samples[VAL_PERF_MAX_SAMPLES];
+    uint64_t        total = 0;
+    uint32_t        start, cycles, i, j;
+    val_status_t    status;
+
+    status = val_cycle_counter_init(&result->freq_hz);
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    if ((count == 0) || (count > VAL_PERF_MAX_SAMPLES))
+    {
+        return VAL_STATUS_INVALID;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if ((setup != NULL) && setup(ctx))
+        {
+            return VAL_STATUS_ERROR;
+        }
+
+        start = val_cycle_counter_read();
+        if (fn(ctx))
+        {
+            return VAL_STATUS_ERROR;
+        }
+        cycles = val_cycle_counter_read() - start;
+        total += cycles;
+
+        /* Keep the samples sorted for the percentile */
+        for (j = i; (j > 0) && (samples[j - 1] > cycles); j--)
+        {
+            samples[j] = samples[j - 1];
+        }
+        samples[j] = cycles;
+    }
+
+    result->iterations = count;
+    result->mean = (uint32_t)(total / count);
+    result->p99 = samples[((count * 99) + 99) / 100 - 1];
+    result->max = samples[count - 1];
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Prints a latency measurement as a single line of space separated
+                key=value pairs:
+                [Perf] op=<name> alg=<hex> size=<bytes> iterations= cycles_per_op=
+                p99_cycles= max_cycles=
+                followed by ops_per_sec= and kbytes_per_sec= if the counter rate is known.
+    @param    - op      : Name of the measured operation
+                alg     : Algorithm or other identifier of the operation variant
+                size    : Size of the object the operation works on, 0 if not applicable
+                bytes   : Number of bytes transferred by one operation, 0 if none
+                result  : Measurement from val_perf_measure_latency
+    @return   - void
+**/
+void val_perf_report_latency(char *op, uint32_t alg, uint32_t size, uint32_t bytes,
+                             val_perf_latency_t *result)
+{
+    val_print(PRINT_ALWAYS, "[Perf] op=", 0);
+    val_print(PRINT_ALWAYS, op, 0);
+    val_print(PRINT_ALWAYS, " alg=0x%x", alg);
+    val_print(PRINT_ALWAYS, " size=%d", size);
+    val_print(PRINT_ALWAYS, " iterations=%d", result->iterations);
+    val_print(PRINT_ALWAYS, " cycles_per_op=%d", result->mean);
+    val_print(PRINT_ALWAYS, " p99_cycles=%d", result->p99);
+    val_print(PRINT_ALWAYS, " max_cycles=%d", result->max);
+
+    if (result->freq_hz && result->mean)
+    {
+        val_print(PRINT_ALWAYS, " ops_per_sec=%d", (int32_t)(result->freq_hz / result->mean));
+        if (bytes)
+        {
+            val_print(PRINT_ALWAYS, " kbytes_per_sec=%d",
+                      (int32_t)(((uint64_t)bytes * result->freq_hz) / result->mean / 1024));
+        }
+    }
+    val_print(PRINT_ALWAYS, "\n", 0);
+}
+
+/* Counters of one thread of val_stress_run */
+typedef struct {
+    uint32_t        index;
+    uint32_t        ops;
+    uint32_t        errors;
+    uint32_t        max;
+    uint32_t        hist[VAL_STRESS_HIST_BUCKETS];
+} val_stress_thread_t;
+
+static struct {
+    val_stress_fn_t         fn;
+    void                    *ctx;
+    uint32_t                start;
+    uint32_t                window;
+    val_stress_thread_t     threads[VAL_STRESS_MAX_THREADS];
+} g_stress;
+
+/**
+    @brief    - Body of a stress thread, runs the operation until the end of the window
+                and times each run. Nothing is printed, the threads share the console.
+    @param    - arg     : Counters of the thread
+    @return   - void
+**/
+static void val_stress_thread(void *arg)
+{
+    val_stress_thread_t     *thread = (val_stress_thread_t *)arg;
+    uint32_t                start, cycles, bucket;
+
+    while ((val_cycle_counter_read() - g_stress.start) < g_stress.window)
+    {
+        start = val_cycle_counter_read();
+        if (g_stress.fn(g_stress.ctx, thread->index))
+        {
+            thread->errors++;
+            continue;
+        }
+        cycles = val_cycle_counter_read() - start;
+
+        bucket = 0;
+        while ((bucket < (VAL_STRESS_HIST_BUCKETS - 1)) && (cycles >> bucket))
+        {
+            bucket++;
+        }
+        thread->hist[bucket]++;
+        thread->max = (cycles > thread->max) ? cycles : thread->max;
+        thread->ops++;
+    }
+}
+
+/**
+    @brief    - Runs an operation on several Non-secure threads at once, for
+                VAL_STRESS_WINDOW_SEC or VAL_STRESS_WINDOW_CYCLES if the counter rate
+                is not known, and sums up the throughput, fairness and latency.
+    @param    - fn      : Operation to run
+                ctx     : Argument passed to the operation, with the thread index
+                threads : Number of threads, up to VAL_STRESS_MAX_THREADS
+                result  : Returns the measurement of the run
+    @return   - val_status_t. VAL_STATUS_UNSUPPORTED if the platform has no cycle counter
+                or no threads.
+**/
+val_status_t val_stress_run(val_stress_fn_t fn, void *ctx, uint32_t threads,
+                            val_stress_result_t *result)
+{
+    void            *args[VAL_STRESS_MAX_THREADS];
+    uint32_t        hist[VAL_STRESS_HIST_BUCKETS] = {0};
+    uint64_t        sum_sq = 0;
+    uint32_t        i, j, rank, count;
+    val_status_t    status;
+
+    if ((threads == 0) || (threads > VAL_STRESS_MAX_THREADS))
+    {
+        return VAL_STATUS_INVALID;
+    }
+
+    status = val_cycle_counter_init(&result->freq_hz);
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    for (i = 0; i < threads; i++)
+    {
+        memset(&g_stress.threads[i], 0, sizeof(g_stress.threads[i]));
+        g_stress.threads[i].index = i;
+        args[i] = &g_stress.threads[i];
+    }
+    g_stress.fn = fn;
+    g_stress.ctx = ctx;
+    g_stress.window = result->freq_hz ? (result->freq_hz * VAL_STRESS_WINDOW_SEC)
+                                      : VAL_STRESS_WINDOW_CYCLES;
+    g_stress.start = val_cycle_counter_read();
+
+    if (pal_thread_run_ns(val_stress_thread, args, threads))
+    {
+        return VAL_STATUS_UNSUPPORTED;
+    }
+    result->cycles = val_cycle_counter_read() - g_stress.start;
+
+    result->threads = threads;
+    result->ops = 0;
+    result->errors = 0;
+    result->min_ops = UINT32_MAX;
+    result->max_ops = 0;
+    result->max = 0;
+    for (i = 0; i < threads; i++)
+    {
+        result->ops += g_stress.threads[i].ops;
+        result->errors += g_stress.threads[i].errors;
+        sum_sq += (uint64_t)g_stress.threads[i].ops * g_stress.threads[i].ops;
+        if (g_stress.threads[i].ops < result->min_ops)
+        {
+            result->min_ops = g_stress.threads[i].ops;
+        }
+        if (g_stress.threads[i].ops > result->max_ops)
+        {
+            result->max_ops = g_stress.threads[i].ops;
+        }
+        if (g_stress.threads[i].max > result->max)
+        {
+            result->max = g_stress.threads[i].max;
+        }
+        for (j = 0; j < VAL_STRESS_HIST_BUCKETS; j++)
+        {
+            hist[j] += g_stress.threads[i].hist[j];
+        }
+    }
+
+    /* Jain's index, 1000 when all the threads completed as many operations */
+    result->fairness = sum_sq ? (uint32_t)(((uint64_t)result->ops * result->ops * 1000)
+                                           / (threads * sum_sq)) : 0;
+
+    /* The bucket of bit length j holds the runs of up to 2^j - 1 cycles */
+    result->p99 = 0;
+    rank = (uint32_t)(((uint64_t)result->ops * 99 + 99) / 100);
+    for (j = 0, count = 0; (j < VAL_STRESS_HIST_BUCKETS) && (rank != 0); j++)
+    {
+        count += hist[j];
+        if (count >= rank)
+        {
+            result->p99 = (j < 32) ? ((1U << j) - 1) : UINT32_MAX;
+            break;
+        }
+    }
+    if (result->p99 > result->max)
+    {
+        result->p99 = result->max;
+    }
+
+    result->starved = 0;
+    for (i = 0; i < threads; i++)
+    {
+        if ((g_stress.threads[i].ops == 0) ||
+            (g_stress.threads[i].ops < (result->ops / threads / VAL_STRESS_STARVE_DIV)))
+        {
+            result->starved++;
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Prints a stress measurement as a single line of space separated
+                key=value pairs:
+                [Stress] op=<name> threads= ops= errors= cycles= ops_per_sec=
+                min_ops= max_ops= fairness= p99_cycles= max_cycles= starved=
+                ops_per_sec= is printed only if the counter rate is known.
+    @param    - op      : Name of the operation
+                result  : Measurement from val_stress_run
+    @return   - void
+**/
+void val_stress_report(char *op, val_stress_result_t *result)
+{
+    val_print(PRINT_ALWAYS, "[Stress] op=", 0);
+    val_print(PRINT_ALWAYS, op, 0);
+    val_print(PRINT_ALWAYS, " threads=%d", result->threads);
+    val_print(PRINT_ALWAYS, " ops=%d", result->ops);
+    val_print(PRINT_ALWAYS, " errors=%d", result->errors);
+    val_print(PRINT_ALWAYS, " cycles=%d", result->cycles);
+    if (result->freq_hz && result->cycles)
+    {
+        val_print(PRINT_ALWAYS, " ops_per_sec=%d",
+                  (int32_t)(((uint64_t)result->ops * result->freq_hz) / result->cycles));
+    }
+    val_print(PRINT_ALWAYS, " min_ops=%d", result->min_ops);
+    val_print(PRINT_ALWAYS, " max_ops=%d", result->max_ops);
+    val_print(PRINT_ALWAYS, " fairness=%d", result->fairness);
+    val_print(PRINT_ALWAYS, " p99_cycles=%d", result->p99);
+    val_print(PRINT_ALWAYS, " max_cycles=%d", result->max);
+    val_print(PRINT_ALWAYS, " starved=%d\n", result->starved);
+}
@@ -28,6 +28,10 @@ uint32_t     val_report_status(void);
 val_status_t val_set_status(uint32_t status);
 uint32_t     val_get_status(void);
 val_status_t val_err_check_set(uint32_t checkpoint, val_status_t status);
+void         val_test_checkpoint(uint32_t checkpoint);
+void         val_test_checkpoint_failed(uint32_t checkpoint);
+val_status_t val_get_test_timing(val_test_timing_t *timing);
+uint32_t     val_get_test_checkpoint(void);
 void         val_test_init(uint32_t test_num, char8_t *desc, uint32_t test_bitfield);
 void         val_test_exit(void);
 val_status_t val_get_last_run_test_id(test_id_t *test_id);
@@ -37,10 +41,20 @@ val_status_t val_switch_to_secure_client(uint32_t test_num);
 val_status_t val_execute_secure_test_func(psa_handle_t *handle, test_info_t test_info,
                                           uint32_t sid);
 val_status_t val_get_secure_test_result(psa_handle_t *handle);
+void         val_close_secure_test_session(psa_handle_t *handle);
 val_status_t val_ipc_connect(uint32_t sid, uint32_t minor_version, psa_handle_t *handle);
 val_status_t val_ipc_call(psa_handle_t handle, psa_invec *in_vec, size_t in_len,
                           psa_outvec *out_vec, size_t out_len);
 void         val_ipc_close(psa_handle_t handle);
 val_status_t val_set_boot_flag(boot_state_t state);
 val_status_t val_get_boot_flag(boot_state_t *state);
+val_status_t val_perf_measure(val_perf_fn_t fn, void *ctx, val_perf_result_t *result);
+void         val_perf_report(char *op, uint32_t alg, uint32_t size, val_perf_result_t *result);
+val_status_t val_perf_measure_latency(val_perf_fn_t setup, val_perf_fn_t fn, void *ctx,
+                                      uint32_t count, val_perf_latency_t *result);
+void         val_perf_report_latency(char *op, uint32_t alg, uint32_t size, uint32_t bytes,
+                                     val_perf_latency_t *result);
+val_status_t val_stress_run(val_stress_fn_t fn, void *ctx, uint32_t threads,
+                            val_stress_result_t *result);
+void         val_stress_report(char *op, val_stress_result_t *result);
 #endif
@@ -33,6 +33,8 @@ const val_api_t val_api = {
     .test_init                 = val_test_init,
     .test_exit                 = val_test_exit,
     .err_check_set             = val_err_check_set,
+    .checkpoint                = val_test_checkpoint,
+    .checkpoint_failed         = val_test_checkpoint_failed,
     .target_get_config         = val_target_get_config,
     .execute_non_secure_tests  = val_execute_non_secure_tests,
     .switch_to_secure_client   = val_switch_to_secure_client,
@@ -50,9 +52,16 @@ const val_api_t val_api = {
     .set_boot_flag             = val_set_boot_flag,
     .get_boot_flag             = val_get_boot_flag,
     .crypto_function           = val_crypto_function,
+    .crypto_get_ops            = val_crypto_get_ops,
     .its_function              = val_its_function,
     .ps_function               = val_ps_function,
     .attestation_function      = val_attestation_function,
+    .perf_measure              = val_perf_measure,
+    .perf_report               = val_perf_report,
+    .perf_measure_latency      = val_perf_measure_latency,
+    .perf_report_latency       = val_perf_report_latency,
+    .stress_run                = val_stress_run,
+    .stress_report             = val_stress_report,
 };
 
 const psa_api_t psa_api = {
@@ -22,6 +22,12 @@
 #include "val_client_defs.h"
 #include "pal_interfaces_ns.h"
 
+/* Checkpoints of the NSPE tests are sampled by the framework timing */
+#undef TEST_CHECKPOINT_SAMPLE
+#define TEST_CHECKPOINT_SAMPLE(num)         val->checkpoint(num)
+#undef TEST_CHECKPOINT_FAILED
+#define TEST_CHECKPOINT_FAILED(num)         val->checkpoint_failed(num)
+
 /* typedef's */
 typedef struct {
     val_status_t     (*print)                     (print_verbosity_t verbosity,
@@ -32,6 +38,8 @@ typedef struct {
                                                    uint32_t test_bitfield);
     void             (*test_exit)                 (void);
     val_status_t     (*err_check_set)             (uint32_t checkpoint, val_status_t status);
+    void             (*checkpoint)                (uint32_t checkpoint);
+    void             (*checkpoint_failed)         (uint32_t checkpoint);
     val_status_t     (*target_get_config)         (cfg_id_t cfg_id, uint8_t **data, uint32_t *size);
     val_status_t     (*execute_non_secure_tests)  (uint32_t test_num, client_test_t *tests_list,
                                                                                 bool_t server_hs);
@@ -54,9 +62,22 @@ typedef struct {
     val_status_t     (*set_boot_flag)             (boot_state_t state);
     val_status_t     (*get_boot_flag)             (boot_state_t *state);
     int32_t          (*crypto_function)           (int type, ...);
+    const val_crypto_ops_t *(*crypto_get_ops)     (void);
     uint32_t         (*its_function)              (int type, ...);
     uint32_t         (*ps_function)               (int type, ...);
     int32_t          (*attestation_function)      (int type, ...);
+    val_status_t     (*perf_measure)              (val_perf_fn_t fn, void *ctx,
+                                                   val_perf_result_t *result);
+    void             (*perf_report)               (char *op, uint32_t alg, uint32_t size,
+                                                   val_perf_result_t *result);
+    val_status_t     (*perf_measure_latency)      (val_perf_fn_t setup, val_perf_fn_t fn,
+                                                   void *ctx, uint32_t count,
+                                                   val_perf_latency_t *result);
+    void             (*perf_report_latency)       (char *op, uint32_t alg, uint32_t size,
+                                                   uint32_t bytes, val_perf_latency_t *result);
+    val_status_t     (*stress_run)                (val_stress_fn_t fn, void *ctx,
+                                                   uint32_t threads, val_stress_result_t *result);
+    void             (*stress_report)             (char *op, val_stress_result_t *result);
 } val_api_t;
 
 typedef struct {
@@ -0,0 +1,300 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_log.h"
+#include "val_dispatcher.h"
+#include "pal_interfaces_ns.h"
+
+/* Set when the binary log mode is built in and the PAL can write raw bytes */
+static uint32_t log_enabled;
+
+typedef struct {
+    uint8_t  data[VAL_LOG_MAX_PAYLOAD + 4];
+    uint32_t len;
+} val_log_frame_t;
+
+/**
+    @brief    - Starts a frame with the given tag
+    @param    - frame : Frame to start
+              - tag   : Record tag
+    @return   - void
+**/
+static void val_log_frame_start(val_log_frame_t *frame, val_log_tag_t tag)
+{
+    frame->data[0] = VAL_LOG_SYNC;
+    frame->data[1] = tag;
+    frame->len = 3;
+}
+
+/**
+    @brief    - Appends a little endian field to the frame payload
+    @param    - frame : Frame being built
+              - value : Field value
+              - size  : Field size in bytes
+    @return   - void
+**/
+static void val_log_frame_put(val_log_frame_t *frame, uint32_t value, uint32_t size)
+{
+    while (size--)
+    {
+        frame->data[frame->len++] = (uint8_t)value;
+        value >>= 8;
+    }
+}
+
+/**
+    @brief    - Completes the frame with its length and check byte, and sends it
+    @param    - frame : Frame to send
+    @return   - val_status_t
+**/
+static val_status_t val_log_frame_send(val_log_frame_t *frame)
+{
+    uint8_t     check = 0;
+    uint32_t    i;
+
+    frame->data[2] = (uint8_t)(frame->len - 3);
+    for (i = 1; i < frame->len; i++)
+    {
+        check ^= frame->data[i];
+    }
+    frame->data[frame->len++] = check;
+
+    if (pal_uart_write_ns(frame->data, frame->len))
+    {
+        return VAL_STATUS_ERROR;
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Returns the ID of a string, its 32-bit FNV-1a hash
+    @param    - string     : String
+              - has_format : Returns 1 if the string has a format specifier
+    @return   - String ID
+**/
+static uint32_t val_log_string_id(char *string, uint32_t *has_format)
+{
+    uint32_t    hash = VAL_LOG_FNV_OFFSET;
+
+    *has_format = 0;
+    for (; *string != '\0'; string++)
+    {
+        if (*string == '%')
+        {
+            *has_format = 1;
+        }
+        hash = (hash ^ (uint8_t)*string) * VAL_LOG_FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+    @brief    - Enables the binary log mode if it is built in and the PAL supports
+                raw UART writes. Otherwise the results are printed as text.
+    @param    - None
+    @return   - val_status_t
+**/
+val_status_t val_log_init(void)
+{
+    log_enabled = 0;
+#ifdef BINARY_LOG
+    if (pal_uart_write_ns(NULL, 0) == 0)
+    {
+        log_enabled = 1;
+    }
+#endif
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Sends a print as a string ID record. The value is sent in the fewest
+                bytes that hold it, negative values take 4 bytes.
+    @param    - string    : Input string
+              - data      : Value for format specifier
+    @return   - val_status_t, VAL_STATUS_UNSUPPORTED if the caller must print the text
+**/
+val_status_t val_log_print(char *string, int32_t data)
+{
+    val_log_frame_t     frame;
+    uint32_t            id, has_format;
+    uint32_t            value = (uint32_t)data;
+
+    if (!log_enabled)
+    {
+        return VAL_STATUS_UNSUPPORTED;
+    }
+
+    id = val_log_string_id(string, &has_format);
+    val_log_frame_start(&frame, LOG_TAG_PRINT);
+    val_log_frame_put(&frame, id, 4);
+    if (has_format)
+    {
+        val_log_frame_put(&frame, value, (value <= 0xFF) ? 1 : ((value <= 0xFFFF) ? 2 : 4));
+    }
+    return val_log_frame_send(&frame);
+}
+
+/**
+    @brief    - Sends the test start record
+    @param    - test_num : Test ID
+              - desc     : Test description
+    @return   - val_status_t, VAL_STATUS_UNSUPPORTED if the caller must print the text
+**/
+val_status_t val_log_test_start(uint32_t test_num, char8_t *desc)
+{
+    val_log_frame_t     frame;
+    uint32_t            has_format;
+
+    if (!log_enabled)
+    {
+        return VAL_STATUS_UNSUPPORTED;
+    }
+
+    val_log_frame_start(&frame, LOG_TAG_TEST_START);
+    val_log_frame_put(&frame, test_num, 2);
+    val_log_frame_put(&frame, val_log_string_id(desc, &has_format), 4);
+    return val_log_frame_send(&frame);
+}
+
+/**
+    @brief    - Sends the test end record, with the timing of the test if it was timed
+    @param    - state  : Test state
+              - status : Test status
+              - timing : Test timing, NULL if the test was not timed
+    @return   - val_status_t, VAL_STATUS_UNSUPPORTED if the caller must print the text
+**/
+val_status_t val_log_test_end(uint8_t state, uint8_t status, val_test_timing_t *timing)
+{
+    val_log_frame_t     frame;
+
+    if (!log_enabled)
+    {
+        return VAL_STATUS_UNSUPPORTED;
+    }
+
+    val_log_frame_start(&frame, LOG_TAG_TEST_END);
+    val_log_frame_put(&frame, state, 1);
+    val_log_frame_put(&frame, status, 1);
+    if (timing != NULL)
+    {
+        val_log_frame_put(&frame, VAL_KCYCLES(timing->cycles), 4);
+        val_log_frame_put(&frame, timing->checkpoints, 2);
+        val_log_frame_put(&frame, timing->max_checkpoint, 2);
+        val_log_frame_put(&frame, timing->max_check_cycles, 4);
+    }
+    return val_log_frame_send(&frame);
+}
+
+/**
+    @brief    - Sends a checkpoint timing record, at PRINT_INFO verbosity
+    @param    - checkpoint : Test debug checkpoint
+              - cycles     : Cycles since the previous checkpoint
+    @return   - val_status_t, VAL_STATUS_UNSUPPORTED if the caller must print the text
+**/
+val_status_t val_log_checkpoint(uint32_t checkpoint, uint32_t cycles)
+{
+    val_log_frame_t     frame;
+
+    if (!log_enabled)
+    {
+        return VAL_STATUS_UNSUPPORTED;
+    }
+
+    if (PRINT_INFO < VERBOSE)
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+    val_log_frame_start(&frame, LOG_TAG_CHECKPOINT);
+    val_log_frame_put(&frame, checkpoint, 2);
+    val_log_frame_put(&frame, cycles, 4);
+    return val_log_frame_send(&frame);
+}
+
+/**
+    @brief    - Sends the suite report record
+    @param    - name            : Suite name
+              - test_count      : Test counts of the suite
+              - slowest_id      : Slowest test, VAL_INVALID_TEST_ID if no test was timed
+              - kcycles         : Total time of the timed tests
+              - slowest_kcycles : Time of the slowest test
+    @return   - val_status_t, VAL_STATUS_UNSUPPORTED if the caller must print the text
+**/
+val_status_t val_log_suite_report(char *name, test_count_t *test_count, test_id_t slowest_id,
+                                  uint32_t kcycles, uint32_t slowest_kcycles)
+{
+    val_log_frame_t     frame;
+    uint32_t            has_format;
+
+    if (!log_enabled)
+    {
+        return VAL_STATUS_UNSUPPORTED;
+    }
+
+    val_log_frame_start(&frame, LOG_TAG_SUITE_REPORT);
+    val_log_frame_put(&frame, val_log_string_id(name, &has_format), 4);
+    val_log_frame_put(&frame, test_count->pass_cnt, 1);
+    val_log_frame_put(&frame, test_count->sim_error_cnt, 1);
+    val_log_frame_put(&frame, test_count->fail_cnt, 1);
+    val_log_frame_put(&frame, test_count->skip_cnt, 1);
+    if (slowest_id != VAL_INVALID_TEST_ID)
+    {
+        val_log_frame_put(&frame, kcycles, 4);
+        val_log_frame_put(&frame, slowest_id, 2);
+        val_log_frame_put(&frame, slowest_kcycles, 4);
+    }
+    return val_log_frame_send(&frame);
+}
+
+/**
+    @brief    - Sends the result table, as a table record followed by a record per entry
+    @param    - results : Result table entries
+              - count   : Number of entries
+    @return   - val_status_t, VAL_STATUS_UNSUPPORTED if the caller must print the text
+**/
+val_status_t val_log_result_table(test_result_t *results, uint32_t count)
+{
+    val_log_frame_t     frame;
+    uint32_t            i;
+
+    if (!log_enabled)
+    {
+        return VAL_STATUS_UNSUPPORTED;
+    }
+
+    val_log_frame_start(&frame, LOG_TAG_RESULT_TABLE);
+    val_log_frame_put(&frame, count, 1);
+    if (val_log_frame_send(&frame))
+    {
+        return VAL_STATUS_ERROR;
+    }
+
+    for (i = 0; i < count; i++, results++)
+    {
+        val_log_frame_start(&frame, LOG_TAG_RESULT);
+        val_log_frame_put(&frame, results->test_id, 2);
+        val_log_frame_put(&frame, results->state, 1);
+        val_log_frame_put(&frame, results->status, 1);
+        val_log_frame_put(&frame, results->checkpoint, 2);
+        val_log_frame_put(&frame, results->elapsed, 2);
+        if (val_log_frame_send(&frame))
+        {
+            return VAL_STATUS_ERROR;
+        }
+    }
+    return VAL_STATUS_SUCCESS;
+}
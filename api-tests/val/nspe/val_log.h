@@ -0,0 +1,64 @@
+/** @file
+ * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _VAL_LOG_H_
+#define _VAL_LOG_H_
+
+#include "val.h"
+#include "val_dispatcher.h"
+
+/* Binary log mode, enabled with -DBINARY_LOG=1. Each record is sent as a frame:
+ *   VAL_LOG_SYNC | tag | length | payload[length] | check
+ * where check is the XOR of the tag, length and payload bytes. Multi-byte fields
+ * are little endian. The decoder prints the fixed text around the records, such as
+ * the result line of a test, so that only the strings of the prints are sent. Strings are sent as their 32-bit FNV-1a hash, which
+ * tools/scripts/decode_binary_log.py maps back to the string literals of the sources.
+ * Keep in sync with tools/scripts/decode_binary_log.py.
+ */
+#define VAL_LOG_SYNC                0xA5
+#define VAL_LOG_MAX_PAYLOAD         24
+#define VAL_LOG_FNV_OFFSET          0x811C9DC5UL
+#define VAL_LOG_FNV_PRIME           0x01000193UL
+
+typedef enum {
+    /* string:4 [, data:1, 2 or 4 if the string has a format specifier] */
+    LOG_TAG_PRINT          = 0x1,
+    /* test_id:2, description string:4 */
+    LOG_TAG_TEST_START     = 0x2,
+    /* state:1, status:1, as kept in the test status buffer
+       [, kcycles:4, checkpoints:2, slowest checkpoint:2, its cycles:4 if the test was timed] */
+    LOG_TAG_TEST_END       = 0x3,
+    /* checkpoint:2, cycles since the previous checkpoint:4 */
+    LOG_TAG_CHECKPOINT     = 0x4,
+    /* suite name string:4, pass:1, sim error:1, fail:1, skip:1
+       [, kcycles:4, slowest test_id:2, its kcycles:4 if any test was timed] */
+    LOG_TAG_SUITE_REPORT   = 0x5,
+    /* entries:1, each sent as a LOG_TAG_RESULT record after this one */
+    LOG_TAG_RESULT_TABLE   = 0x6,
+    /* test_id:2, state:1, status:1, checkpoint:2, elapsed:2, as in test_result_t */
+    LOG_TAG_RESULT         = 0x7,
+} val_log_tag_t;
+
+val_status_t val_log_init(void);
+val_status_t val_log_print(char *string, int32_t data);
+val_status_t val_log_test_start(uint32_t test_num, char8_t *desc);
+val_status_t val_log_test_end(uint8_t state, uint8_t status, val_test_timing_t *timing);
+val_status_t val_log_checkpoint(uint32_t checkpoint, uint32_t cycles);
+val_status_t val_log_suite_report(char *name, test_count_t *test_count, test_id_t slowest_id,
+                                  uint32_t kcycles, uint32_t slowest_kcycles);
+val_status_t val_log_result_table(test_result_t *results, uint32_t count);
+#endif
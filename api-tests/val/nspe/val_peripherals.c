@@ -20,10 +20,32 @@
 #include "pal_interfaces_ns.h"
 #include "val_framework.h"
 #include "val_client_defs.h"
+#include "val_log.h"
 
 /* Global */
 uint32_t   is_uart_init_done = 0;
 
+/* RAM shadow of the NVMEM bookkeeping slots. Writes to the slots are collected in the
+ * shadow and committed to NVMEM as one range write by val_nvmem_sync. */
+#define VAL_NVMEM_SHADOW_SIZE      VAL_NVMEM_OFFSET(NV_SLOWEST_KCYCLES + 1)
+
+static uint8_t    nvmem_shadow[VAL_NVMEM_SHADOW_SIZE];
+static uint32_t   nvmem_shadow_valid = 0;
+static uint32_t   nvmem_dirty_start = VAL_NVMEM_SHADOW_SIZE;
+static uint32_t   nvmem_dirty_end = 0;
+
+/* Watchdog timeout profile, see wd_profile_t */
+static wd_profile_t wd_profile;
+static bool_t       wd_calibrate;
+static uint32_t     wd_freq_hz;         /* 0 if the windows cannot be measured */
+static uint32_t     wd_comp;
+static uint32_t     wd_index = VAL_WD_PROFILE_MAX_TESTS;
+static uint32_t     wd_start;
+static bool_t       wd_running;
+static uint32_t     wd_max_us;
+static uint32_t     wd_timeout_us;      /* Last programmed timeout */
+static bool_t       wd_slow;            /* A window could outlast the wrap of the counter */
+
 /*
     @brief    - Initialize UART.
                 This is client interface API of secure partition UART INIT API.
@@ -45,7 +67,20 @@ val_status_t val_uart_init(void)
     }
 
     is_uart_init_done = 1;
-    return pal_uart_init_ns(uart_desc->base);
+    status = pal_uart_init_ns(uart_desc->base);
+    if (VAL_ERROR(status))
+    {
+         return status;
+    }
+
+    /* Prints are sent from the TX interrupt if the platform routes it. The UART
+       stays polled if the PAL does not support it */
+    if (uart_desc->intr_id != INTR_ID_NONE)
+    {
+        (void)pal_uart_tx_irq_init_ns(uart_desc->intr_id);
+    }
+
+    return val_log_init();
 }
 
 /**
@@ -62,9 +97,37 @@ val_status_t val_print(print_verbosity_t verbosity, char *string, int32_t data)
     {
        return VAL_STATUS_SUCCESS;
     }
+
+    /* In the binary log mode the string is sent as an ID */
+    if (val_log_print(string, data) == VAL_STATUS_SUCCESS)
+    {
+        return (verbosity == PRINT_ERROR) ? pal_print_flush_ns() : VAL_STATUS_SUCCESS;
+    }
+
+    /* Errors are often followed by a hang, do not keep them queued */
+    if (verbosity == PRINT_ERROR)
+    {
+        pal_print_ns(string, data);
+        return pal_print_flush_ns();
+    }
     return pal_print_ns(string, data);
 }
 
+/**
+    @brief    - Sends the print data queued by the PAL to the UART. Called at points
+                where the output must be visible, e.g. at the end of each test.
+    @param    - None
+    @return   - val_status_t
+**/
+val_status_t val_print_flush(void)
+{
+    if (is_uart_init_done == 0)
+    {
+       return VAL_STATUS_SUCCESS;
+    }
+    return pal_print_flush_ns();
+}
+
 /**
     @brief    - This API will read from slave address via SPI
     @param    - addr : Slave address
@@ -77,7 +140,172 @@ val_status_t val_spi_read(addr_t addr, uint8_t *data, uint32_t len)
         return pal_spi_read(addr, data, len);
 }
 
+/**
+    @brief    - Enables the cycle counter used for performance measurements
+    @param    - freq_hz : Returns the counter frequency in Hz, 0 if not known
+    @return   - error status
+**/
+val_status_t val_cycle_counter_init(uint32_t *freq_hz)
+{
+    *freq_hz = 0;
+    if (pal_cycle_counter_init_ns(freq_hz))
+    {
+        return VAL_STATUS_UNSUPPORTED;
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Reads the cycle counter
+    @return   - Counter value, wraps around at 32 bits
+**/
+uint32_t val_cycle_counter_read(void)
+{
+    return pal_cycle_counter_read_ns();
+}
+
 /* Watchdog APIs */
+/**
+    @brief    - Adds the watchdog window which ends now to the measurement of the
+                current test. Windows that could outlast the wrap of the cycle counter
+                are not measured, see val_wd_timer_enable.
+    @return   - void
+**/
+static void val_wd_profile_sample(void)
+{
+    uint32_t    cycles, us;
+
+    cycles = val_cycle_counter_read() - wd_start;
+    us = (uint32_t)(((uint64_t)cycles * 1000000) / wd_freq_hz);
+    if (us > wd_max_us)
+    {
+        wd_max_us = us;
+    }
+    wd_running = 0;
+}
+
+/**
+    @brief    - Returns the watchdog timeout to program for the current test
+    @param    - time_us : Timeout of the target configuration
+    @return   - Timeout from the profile, if any and shorter, else time_us
+**/
+static uint32_t val_wd_profile_timeout(uint32_t time_us)
+{
+    uint32_t    window, profile_us;
+
+    if (wd_calibrate || (wd_index >= VAL_WD_PROFILE_MAX_TESTS)
+        || (wd_profile.magic != VAL_WD_PROFILE_MAGIC) || (wd_profile.comp != wd_comp))
+    {
+        return time_us;
+    }
+
+    window = wd_profile.window[wd_index];
+    if ((window == 0) || (window == VAL_WD_PROFILE_SLOW))
+    {
+        return time_us;
+    }
+
+    profile_us = window * VAL_WD_PROFILE_UNIT_US * VAL_WD_PROFILE_MARGIN;
+    if (profile_us < VAL_WD_PROFILE_MIN_US)
+    {
+        profile_us = VAL_WD_PROFILE_MIN_US;
+    }
+    return (profile_us < time_us) ? profile_us : time_us;
+}
+
+/**
+    @brief    - Reads the watchdog timeout profile from NVMEM
+    @param    - calibrate : 1 to record the profile in this run, 0 to use it
+    @return   - error status. VAL_STATUS_UNSUPPORTED if the windows cannot be measured
+                for calibration, as the platform has no cycle counter of known frequency.
+**/
+val_status_t val_wd_profile_init(bool_t calibrate)
+{
+    val_status_t    status;
+
+    wd_calibrate = calibrate;
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_WD_PROFILE), &wd_profile, sizeof(wd_profile_t));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    if (!calibrate)
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+    if (VAL_ERROR(val_cycle_counter_init(&wd_freq_hz)) || (wd_freq_hz == 0))
+    {
+        wd_freq_hz = 0;
+        return VAL_STATUS_UNSUPPORTED;
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Starts the watchdog window measurement of a test
+    @param    - test_id : Test ID
+    @return   - void
+**/
+void val_wd_profile_start(uint32_t test_id)
+{
+    wd_comp    = VAL_GET_COMP_NUM(test_id);
+    wd_index   = VAL_GET_TEST_NUM(test_id);
+    wd_running = 0;
+    wd_max_us  = 0;
+    wd_slow    = 0;
+}
+
+/**
+    @brief    - Ends the watchdog window measurement of the current test. In a
+                calibration run, the longest window of a passed test is kept in the
+                profile, if it is longer than the one recorded by a previous run. A
+                test with a window which could not be measured is recorded as
+                VAL_WD_PROFILE_SLOW, so that it keeps the timeout of the target.
+    @param    - passed : 1 if the test passed
+    @return   - error status
+**/
+val_status_t val_wd_profile_end(bool_t passed)
+{
+    uint32_t    window;
+
+    if (!wd_calibrate || !wd_freq_hz || !passed || (wd_index >= VAL_WD_PROFILE_MAX_TESTS))
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+    /* A profile of another suite is replaced */
+    if ((wd_profile.magic != VAL_WD_PROFILE_MAGIC) || (wd_profile.comp != wd_comp))
+    {
+        memset(&wd_profile, 0, sizeof(wd_profile_t));
+        wd_profile.magic = VAL_WD_PROFILE_MAGIC;
+        wd_profile.comp  = (uint8_t)wd_comp;
+    }
+
+    window = (wd_max_us + VAL_WD_PROFILE_UNIT_US - 1) / VAL_WD_PROFILE_UNIT_US;
+    if (wd_slow)
+    {
+        window = VAL_WD_PROFILE_SLOW;
+    }
+    else if (window == 0)
+    {
+        window = 1;
+    }
+    else if (window > VAL_WD_PROFILE_SLOW)
+    {
+        window = VAL_WD_PROFILE_SLOW;
+    }
+
+    if (window <= wd_profile.window[wd_index])
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+    wd_profile.window[wd_index] = (uint8_t)window;
+    return val_nvmem_write(VAL_NVMEM_OFFSET(NV_WD_PROFILE), &wd_profile, sizeof(wd_profile_t));
+}
+
 /**
     @brief    - Initializes the WatchDog Timer instance. This is client interface API of
                 secure partition val_wd_timer_init_sf API for nspe world.
@@ -117,6 +345,8 @@ val_status_t val_wd_timer_init(wd_timeout_type_t timeout_type)
        time_us = soc_per_desc->timeout_in_micro_sec_high;
    }
 
+   time_us = val_wd_profile_timeout(time_us);
+   wd_timeout_us = time_us;
    return pal_wd_timer_init_ns(soc_per_desc->base,
                                time_us,
                                soc_per_desc->num_of_tick_per_micro_sec);
@@ -141,6 +371,17 @@ val_status_t val_wd_timer_enable(void)
         return status;
    }
 
+   /* The 32-bit cycle counter wraps before a window of the programmed timeout can end,
+      e.g. after 4.29 s at 1 GHz, so such a window cannot be measured */
+   if (wd_freq_hz && ((((uint64_t)wd_timeout_us * wd_freq_hz) / 1000000) > UINT32_MAX))
+   {
+       wd_slow = 1;
+   }
+   else if (wd_freq_hz)
+   {
+       wd_start = val_cycle_counter_read();
+       wd_running = 1;
+   }
    return pal_wd_timer_enable_ns(soc_per_desc->base);
 }
 
@@ -163,6 +404,10 @@ val_status_t val_wd_timer_disable(void)
         return status;
    }
 
+   if (wd_running)
+   {
+       val_wd_profile_sample();
+   }
    return pal_wd_timer_disable_ns(soc_per_desc->base);
 }
 
@@ -193,10 +438,55 @@ val_status_t val_wd_reprogram_timer(wd_timeout_type_t timeout_type)
 }
 
 
+/*
+    @brief     - Returns the NVMEM base address from the target configuration
+    @param     - base      : Pointer to return the base address
+    @return    - val_status_t
+*/
+static val_status_t val_nvmem_get_base(addr_t *base)
+{
+   memory_desc_t   *memory_desc;
+   val_status_t    status = VAL_STATUS_SUCCESS;
+
+   status = val_target_get_config(TARGET_CONFIG_CREATE_ID(GROUP_MEMORY, MEMORY_NVMEM, 0),
+                                  (uint8_t **)&memory_desc,
+                                  (uint32_t *)sizeof(memory_desc_t));
+
+   if (VAL_ERROR(status))
+   {
+        return status;
+   }
+
+   *base = memory_desc->start;
+   return status;
+}
+
+/*
+    @brief     - Loads the NVMEM bookkeeping slots into the RAM shadow if not yet done
+    @param     - base      : NVMEM base address
+    @return    - val_status_t
+*/
+static val_status_t val_nvmem_shadow_load(addr_t base)
+{
+   if (nvmem_shadow_valid)
+   {
+        return VAL_STATUS_SUCCESS;
+   }
+
+   if (pal_nvmem_read_ns(base, 0, nvmem_shadow, VAL_NVMEM_SHADOW_SIZE))
+   {
+        return VAL_STATUS_READ_FAILED;
+   }
+
+   nvmem_shadow_valid = 1;
+   return VAL_STATUS_SUCCESS;
+}
+
 /*
     @brief     - Reads 'size' bytes from Non-volatile memory at a given. This is client interface
                 API of secure partition val_nvmem_read_sf API for nspe world.
-                'base + offset' into given buffer.
+                'base + offset' into given buffer. The bookkeeping slots are served from
+                the RAM shadow.
                - offset    : Offset from NV MEM base address
                - buffer    : Pointer to source address
                - size      : Number of bytes
@@ -204,25 +494,41 @@ val_status_t val_wd_reprogram_timer(wd_timeout_type_t timeout_type)
 */
 val_status_t val_nvmem_read(uint32_t offset, void *buffer, int size)
 {
-   memory_desc_t   *memory_desc;
+   addr_t          base;
    val_status_t    status = VAL_STATUS_SUCCESS;
 
-   status = val_target_get_config(TARGET_CONFIG_CREATE_ID(GROUP_MEMORY, MEMORY_NVMEM, 0),
-                                  (uint8_t **)&memory_desc,
-                                  (uint32_t *)sizeof(memory_desc_t));
+   status = val_nvmem_get_base(&base);
+   if (VAL_ERROR(status))
+   {
+        return status;
+   }
+
+   if ((size < 0) || ((offset + size) > VAL_NVMEM_SHADOW_SIZE))
+   {
+        /* Outside the shadow, commit and drop it to stay coherent with NVMEM */
+        status = val_nvmem_sync();
+        if (VAL_ERROR(status))
+        {
+             return status;
+        }
+        return pal_nvmem_read_ns(base, offset, buffer, size);
+   }
 
+   status = val_nvmem_shadow_load(base);
    if (VAL_ERROR(status))
    {
         return status;
    }
 
-   return pal_nvmem_read_ns(memory_desc->start, offset, buffer, size);
+   memcpy(buffer, &nvmem_shadow[offset], size);
+   return status;
 }
 
 /*
     @brief     - Writes 'size' bytes from buffer into non-volatile memory at a given
                  'base + offset'.  This is client interface API of secure partition
-                 val_nvmem_write_sf API for nspe world.
+                 val_nvmem_write_sf API for nspe world. Writes to the bookkeeping slots
+                 only update the RAM shadow, and they reach NVMEM at the next val_nvmem_sync.
                - offset    : Offset
                - buffer    : Pointer to source address
                - size      : Number of bytes
@@ -230,17 +536,74 @@ val_status_t val_nvmem_read(uint32_t offset, void *buffer, int size)
 */
 val_status_t val_nvmem_write(uint32_t offset, void *buffer, int size)
 {
-   memory_desc_t   *memory_desc;
+   addr_t          base;
    val_status_t    status = VAL_STATUS_SUCCESS;
 
-   status = val_target_get_config(TARGET_CONFIG_CREATE_ID(GROUP_MEMORY, MEMORY_NVMEM, 0),
-                                  (uint8_t **)&memory_desc,
-                                  (uint32_t *)sizeof(memory_desc_t));
+   status = val_nvmem_get_base(&base);
+   if (VAL_ERROR(status))
+   {
+        return status;
+   }
+
+   if ((size < 0) || ((offset + size) > VAL_NVMEM_SHADOW_SIZE))
+   {
+        /* Outside the shadow, commit and drop it to stay coherent with NVMEM */
+        status = val_nvmem_sync();
+        if (VAL_ERROR(status))
+        {
+             return status;
+        }
+        return pal_nvmem_write_ns(base, offset, buffer, size);
+   }
 
+   status = val_nvmem_shadow_load(base);
    if (VAL_ERROR(status))
    {
         return status;
    }
 
-   return pal_nvmem_write_ns(memory_desc->start, offset, buffer, size);
+   memcpy(&nvmem_shadow[offset], buffer, size);
+
+   if (offset < nvmem_dirty_start)
+   {
+        nvmem_dirty_start = offset;
+   }
+   if ((offset + size) > nvmem_dirty_end)
+   {
+        nvmem_dirty_end = offset + size;
+   }
+   return status;
+}
+
+/*
+    @brief     - Commits the dirty range of the NVMEM shadow with a single write and
+                 drops the shadow, so that the next access reloads it. The slots may
+                 also be written from the secure side, e.g. the boot flag.
+    @param     - None
+    @return    - val_status_t
+*/
+val_status_t val_nvmem_sync(void)
+{
+   addr_t          base;
+   val_status_t    status = VAL_STATUS_SUCCESS;
+
+   if (nvmem_dirty_start < nvmem_dirty_end)
+   {
+        status = val_nvmem_get_base(&base);
+        if (VAL_ERROR(status))
+        {
+             return status;
+        }
+
+        if (pal_nvmem_write_ns(base, nvmem_dirty_start, &nvmem_shadow[nvmem_dirty_start],
+                               nvmem_dirty_end - nvmem_dirty_start))
+        {
+             return VAL_STATUS_WRITE_FAILED;
+        }
+   }
+
+   nvmem_dirty_start = VAL_NVMEM_SHADOW_SIZE;
+   nvmem_dirty_end = 0;
+   nvmem_shadow_valid = 0;
+   return status;
 }
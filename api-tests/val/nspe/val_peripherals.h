@@ -20,13 +20,40 @@
 
 #include "val.h"
 
+#define VAL_WD_PROFILE_MAGIC       0x5744  /* "WD" */
+#define VAL_WD_PROFILE_MAX_TESTS   128
+#define VAL_WD_PROFILE_UNIT_US     20000   /* 20 ms */
+#define VAL_WD_PROFILE_SLOW        0xFF    /* Window too long to record */
+#define VAL_WD_PROFILE_MARGIN      3
+#define VAL_WD_PROFILE_MIN_US      250000
+
+/* Longest watchdog window of each test of one suite, kept in NVMEM at NV_WD_PROFILE.
+ * A window lasts from a watchdog enable to the following disable. The profile is
+ * recorded by a calibration run. Later runs program VAL_WD_PROFILE_MARGIN times the
+ * window, but not less than VAL_WD_PROFILE_MIN_US, when that is below the timeout
+ * of the target configuration. */
+typedef struct {
+    uint16_t  magic;
+    uint8_t   comp;             /* Component of the tests, VAL_GET_COMP_NUM */
+    uint8_t   reserved;
+    uint8_t   window[VAL_WD_PROFILE_MAX_TESTS]; /* By VAL_GET_TEST_NUM, in VAL_WD_PROFILE_UNIT_US.
+                                                   0 if not recorded */
+} wd_profile_t;
+
 val_status_t val_uart_init(void);
 val_status_t val_print(print_verbosity_t verbosity, char *string, int32_t data);
+val_status_t val_print_flush(void);
 val_status_t val_spi_read(addr_t addr, uint8_t *data, uint32_t len);
+val_status_t val_cycle_counter_init(uint32_t *freq_hz);
+uint32_t     val_cycle_counter_read(void);
 val_status_t val_nvmem_read(uint32_t offset, void *buffer, int size);
 val_status_t val_nvmem_write(uint32_t offset, void *buffer, int size);
+val_status_t val_nvmem_sync(void);
 val_status_t val_wd_timer_init(wd_timeout_type_t timeout_type);
 val_status_t val_wd_timer_enable(void);
 val_status_t val_wd_timer_disable(void);
 val_status_t val_wd_reprogram_timer(wd_timeout_type_t timeout_type);
+val_status_t val_wd_profile_init(bool_t calibrate);
+void         val_wd_profile_start(uint32_t test_id);
+val_status_t val_wd_profile_end(bool_t passed);
 #endif
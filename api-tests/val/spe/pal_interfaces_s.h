@@ -105,4 +105,18 @@ void pal_generate_interrupt(void);
     @return  - void
 **/
 void pal_disable_interrupt(void);
+
+/**
+    @brief   - Enables the cycle counter of the CPU
+    @param   - freq_hz : Returns the counter frequency in Hz, 0 if not known
+    @return  - SUCCESS/FAILURE
+**/
+int pal_cycle_counter_init(uint32_t *freq_hz);
+
+/**
+    @brief   - Reads the cycle counter of the CPU
+    @param   - void
+    @return  - Counter value, wraps around at 32 bits
+**/
+uint32_t pal_cycle_counter_read(void);
 #endif
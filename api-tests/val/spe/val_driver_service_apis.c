@@ -141,6 +141,40 @@ val_status_t val_nvmem_write_sf(addr_t base, uint32_t offset, void *buffer, int
     }
 }
 
+/* Cycle counter APIs */
+/**
+    @brief    - Enables the cycle counter used to time the secure performance tests.
+                The counter is enabled on the first call only.
+    @param    - freq_hz : Returns the counter frequency in Hz, 0 if not known
+    @return   - val_status_t
+**/
+val_status_t val_cycle_counter_init_sf(uint32_t *freq_hz)
+{
+    static uint32_t init_done, counter_freq_hz;
+
+    if (!init_done)
+    {
+        if (pal_cycle_counter_init(&counter_freq_hz))
+        {
+            return VAL_STATUS_UNSUPPORTED;
+        }
+        init_done = 1;
+    }
+
+    *freq_hz = counter_freq_hz;
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Reads the cycle counter enabled by val_cycle_counter_init_sf
+    @param    - void
+    @return   - Counter value, wraps around at 32 bits
+**/
+uint32_t val_cycle_counter_read_sf(void)
+{
+    return pal_cycle_counter_read();
+}
+
 /**
     @brief    - This function sets the given boot.state value to corresponding
                 boot NVMEM location
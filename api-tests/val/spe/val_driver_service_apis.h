@@ -33,6 +33,8 @@ val_status_t val_wd_timer_disable_sf(addr_t base_addr);
 val_status_t val_is_wd_timer_enabled_sf(addr_t base_addr);
 val_status_t val_nvmem_read_sf(addr_t base, uint32_t offset, void *buffer, int size);
 val_status_t val_nvmem_write_sf(addr_t base, uint32_t offset, void *buffer, int size);
+val_status_t val_cycle_counter_init_sf(uint32_t *freq_hz);
+uint32_t val_cycle_counter_read_sf(void);
 val_status_t val_driver_private_set_boot_flag_fn(boot_state_t state);
 val_status_t val_init_driver_memory(void);
 val_status_t val_get_driver_mmio_addr(addr_t *base_addr);
@@ -48,9 +48,15 @@ __UNUSED STATIC_DECLARE val_status_t val_execute_secure_tests
 __UNUSED STATIC_DECLARE val_status_t val_execute_secure_test_func
                         (psa_handle_t *handle, test_info_t test_info, uint32_t sid);
 __UNUSED STATIC_DECLARE val_status_t val_get_secure_test_result(psa_handle_t *handle);
+__UNUSED STATIC_DECLARE void val_close_secure_test_session(psa_handle_t *handle);
 __UNUSED STATIC_DECLARE val_status_t val_err_check_set(uint32_t checkpoint, val_status_t status);
 __UNUSED STATIC_DECLARE val_status_t val_nvmem_write(uint32_t offset, void *buffer, int size);
 __UNUSED STATIC_DECLARE val_status_t val_set_boot_flag(boot_state_t state);
+__UNUSED STATIC_DECLARE val_status_t val_cycle_counter_read(uint32_t *cycles, uint32_t *freq_hz);
+__UNUSED STATIC_DECLARE val_status_t val_perf_measure
+                        (val_perf_fn_t fn, void *ctx, val_perf_result_t *result);
+__UNUSED STATIC_DECLARE void val_perf_report
+                        (char *op, uint32_t alg, uint32_t size, val_perf_result_t *result);
 
 __UNUSED static val_api_t val_api = {
     .print                     = val_print,
@@ -65,6 +71,8 @@ __UNUSED static val_api_t val_api = {
     .process_connect_request   = val_process_connect_request,
     .process_call_request      = val_process_call_request,
     .process_disconnect_request= val_process_disconnect_request,
+    .perf_measure              = val_perf_measure,
+    .perf_report               = val_perf_report,
 };
 
 __UNUSED static psa_api_t psa_api = {
@@ -315,7 +323,7 @@ STATIC_DECLARE val_status_t val_execute_secure_tests(test_info_t test_info, clie
 {
     val_status_t          status = VAL_STATUS_SUCCESS;
     val_status_t          test_status = VAL_STATUS_SUCCESS;
-    psa_handle_t          handle;
+    psa_handle_t          handle = PSA_NULL_HANDLE;
     int                   i = test_info.block_num;
 
     while (tests_list[i] != NULL)
@@ -329,7 +337,7 @@ STATIC_DECLARE val_status_t val_execute_secure_tests(test_info_t test_info, clie
         if (VAL_ERROR(status))
         {
             val_print(PRINT_ERROR,"[Check%d] START\n", i);
-            return status;
+            break;
         }
         else
         {
@@ -346,12 +354,12 @@ STATIC_DECLARE val_status_t val_execute_secure_tests(test_info_t test_info, clie
         if (IS_TEST_SKIP(status))
         {
             val_print(PRINT_DEBUG, "[Check%d] SKIPPED\n", i);
-            return status;
+            break;
         }
         if (VAL_ERROR(status))
         {
             val_print(PRINT_DEBUG,"[Check%d] FAILED\n", i);
-            return status;
+            break;
         }
         else
         {
@@ -359,6 +367,9 @@ STATIC_DECLARE val_status_t val_execute_secure_tests(test_info_t test_info, clie
         }
         i++;
     }
+
+    /* End of the server dispatcher session */
+    val_close_secure_test_session(&handle);
     return status;
 }
 
@@ -367,7 +378,9 @@ STATIC_DECLARE val_status_t val_execute_secure_tests(test_info_t test_info, clie
                 - nonsecure client to server test fn
                 - secure client and server test fn
                 - nonsecure client to secure client test fn
-    @param    - handle     : handle returned while connecting given sid
+                The dispatcher is connected on the first handshake, the following ones
+                reuse the connection until val_close_secure_test_session.
+    @param    - handle     : handle of the dispatcher connection, PSA_NULL_HANDLE if none
     @param    - test_info  : Test_num and block_num to be executed
     @param    - sid        : RoT service to be connected. Partition dispatcher sid
     @return   - val_status_t
@@ -380,12 +393,15 @@ STATIC_DECLARE val_status_t val_execute_secure_test_func(psa_handle_t *handle,
     val_status_t    status = VAL_STATUS_SUCCESS;
     psa_status_t    status_of_call = PSA_SUCCESS;
 
-    *handle = psa_connect(sid, 0);
-
-    if (*handle < 0)
+    if (*handle == PSA_NULL_HANDLE)
     {
-        val_print(PRINT_ERROR, "Could not connect SID. Handle=%x\n", *handle);
-        status = VAL_STATUS_CONNECTION_FAILED;
+        *handle = psa_connect(sid, 0);
+        if (*handle < 0)
+        {
+            val_print(PRINT_ERROR, "Could not connect SID. Handle=%x\n", *handle);
+            *handle = PSA_NULL_HANDLE;
+            return VAL_STATUS_CONNECTION_FAILED;
+        }
     }
 
     test_data = ((uint32_t)(test_info.test_num) | ((uint32_t)(test_info.block_num) << BLOCK_NUM_POS)
@@ -398,14 +414,14 @@ STATIC_DECLARE val_status_t val_execute_secure_test_func(psa_handle_t *handle,
     {
         status = VAL_STATUS_CALL_FAILED;
         val_print(PRINT_ERROR, "Call to dispatch SF failed. Status=%x\n", status_of_call);
-        psa_close(*handle);
+        val_close_secure_test_session(handle);
     }
     return status;
 }
 
 /**
     @brief    - This function is used to retrive the status of previously connected test function
-                using val_execute_secure_test_func
+                using val_execute_secure_test_func. The connection is kept for the next one.
     @param    - handle     : handle of server function. Handle of Partition dispatcher sid
     @return   - The status of test functions
 **/
@@ -427,10 +443,24 @@ STATIC_DECLARE val_status_t val_get_secure_test_result(psa_handle_t *handle)
         val_print(PRINT_ERROR, "Call to dispatch SF failed. Status=%x\n", status_of_call);
     }
 
-    psa_close(*handle);
     return status;
 }
 
+/**
+    @brief    - Closes the dispatcher connection of val_execute_secure_test_func, which
+                ends the session of the test with the partition
+    @param    - handle     : handle of the dispatcher connection, set to PSA_NULL_HANDLE
+    @return   - void
+**/
+STATIC_DECLARE void val_close_secure_test_session(psa_handle_t *handle)
+{
+    if (*handle != PSA_NULL_HANDLE)
+    {
+        psa_close(*handle);
+        *handle = PSA_NULL_HANDLE;
+    }
+}
+
 /*
     @brief           - This function checks if the input status argument is an error.
                        On error, print the checkpoint value
@@ -522,4 +552,161 @@ STATIC_DECLARE val_status_t val_set_boot_flag(boot_state_t state)
    }
    return status;
 }
-#endif
+
+/**
+    @brief    - Reads the cycle counter of the CPU. The test partitions may not access
+                it, so it is read by the driver partition.
+    @param    - cycles  : Returns the counter value
+              - freq_hz : Returns the counter frequency in Hz, 0 if not known. May be NULL.
+    @return   - val_status_t
+**/
+STATIC_DECLARE val_status_t val_cycle_counter_read(uint32_t *cycles, uint32_t *freq_hz)
+{
+   driver_test_fn_id_t  driver_test_fn_id = TEST_CYCLE_COUNTER_READ;
+   psa_handle_t         handle = 0;
+   psa_status_t         status_of_call = PSA_SUCCESS;
+
+   psa_invec invec[1] = {{&driver_test_fn_id, sizeof(driver_test_fn_id)}};
+   psa_outvec outvec[2] = {{cycles, sizeof(*cycles)},
+                           {freq_hz, (freq_hz != NULL) ? sizeof(*freq_hz) : 0}};
+
+   handle = psa_connect(DRIVER_TEST_SID, 0);
+   if (handle < 0)
+   {
+       return VAL_STATUS_CONNECTION_FAILED;
+   }
+
+   status_of_call = psa_call(handle, invec, 1, outvec, 2);
+   psa_close(handle);
+   if (status_of_call == VAL_STATUS_UNSUPPORTED)
+   {
+       return VAL_STATUS_UNSUPPORTED;
+   }
+   else if (status_of_call != PSA_SUCCESS)
+   {
+       return VAL_STATUS_CALL_FAILED;
+   }
+   return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Measures the cycles taken by an operation, as val_perf_measure of the
+                NSPE does. Each read of the counter is a call to the driver partition,
+                so the cost of a read is measured first and taken off the measurement.
+    @param    - fn      : Operation to measure
+                ctx     : Argument passed to the operation
+                result  : Returns the number of iterations and the cycles they took
+    @return   - val_status_t
+**/
+STATIC_DECLARE val_status_t val_perf_measure(val_perf_fn_t fn, void *ctx,
+                                             val_perf_result_t *result)
+{
+    uint32_t        window, start, end, overhead = UINT32_MAX, cycles, i;
+    val_status_t    status;
+
+    /* The cheapest of a few reads in a row, in case one of them is interrupted */
+    for (i = 0; i < VAL_PERF_READ_RUNS; i++)
+    {
+        status = val_cycle_counter_read(&start, &result->freq_hz);
+        if (VAL_ERROR(status))
+        {
+            return status;
+        }
+        status = val_cycle_counter_read(&end, NULL);
+        if (VAL_ERROR(status))
+        {
+            return status;
+        }
+        overhead = ((end - start) < overhead) ? (end - start) : overhead;
+    }
+
+    window = result->freq_hz ? (result->freq_hz / VAL_PERF_WINDOW_DIV) : VAL_PERF_WINDOW_CYCLES;
+
+    /* The first run also warms up caches and lazily set up state */
+    status = val_cycle_counter_read(&start, NULL);
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+    if (fn(ctx))
+    {
+        return VAL_STATUS_ERROR;
+    }
+    status = val_cycle_counter_read(&end, NULL);
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+    cycles = ((end - start) > overhead) ? (end - start - overhead) : 0;
+
+    if (cycles == 0)
+    {
+        result->iterations = VAL_PERF_MAX_ITERATIONS;
+    }
+    else
+    {
+        result->iterations = (cycles < window) ? (window / cycles) : 1;
+        if (result->iterations > VAL_PERF_MAX_ITERATIONS)
+        {
+            result->iterations = VAL_PERF_MAX_ITERATIONS;
+        }
+    }
+
+    status = val_cycle_counter_read(&start, NULL);
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+    for (i = 0; i < result->iterations; i++)
+    {
+        if (fn(ctx))
+        {
+            return VAL_STATUS_ERROR;
+        }
+    }
+    status = val_cycle_counter_read(&end, NULL);
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+    result->cycles = ((end - start) > overhead) ? (end - start - overhead) : 0;
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Prints a performance measurement in the format of val_perf_report of
+                the NSPE
+    @param    - op      : Name of the measured operation
+                alg     : Algorithm or other identifier of the operation variant
+                size    : Number of bytes processed by one operation, 0 if not applicable
+                result  : Measurement from val_perf_measure
+    @return   - void
+**/
+STATIC_DECLARE void val_perf_report(char *op, uint32_t alg, uint32_t size,
+                                    val_perf_result_t *result)
+{
+    uint64_t        ops_per_sec;
+
+    val_print(PRINT_ALWAYS, "[Perf] op=", 0);
+    val_print(PRINT_ALWAYS, op, 0);
+    val_print(PRINT_ALWAYS, " alg=0x%x", alg);
+    val_print(PRINT_ALWAYS, " size=%d", size);
+    val_print(PRINT_ALWAYS, " iterations=%d", result->iterations);
+    val_print(PRINT_ALWAYS, " cycles=%d", result->cycles);
+    val_print(PRINT_ALWAYS, " cycles_per_op=%d", result->cycles / result->iterations);
+
+    if (result->freq_hz && result->cycles)
+    {
+        ops_per_sec = ((uint64_t)result->iterations * result->freq_hz) / result->cycles;
+        val_print(PRINT_ALWAYS, " ops_per_sec=%d", (int32_t)ops_per_sec);
+        if (size)
+        {
+            val_print(PRINT_ALWAYS, " kbytes_per_sec=%d",
+                      (int32_t)(((uint64_t)result->iterations * size * result->freq_hz)
+                                / result->cycles / 1024));
+        }
+    }
+    val_print(PRINT_ALWAYS, "\n", 0);
+}
+#endif
\ No newline at end of file
@@ -84,5 +84,9 @@ typedef struct {
   val_status_t (*process_connect_request)    (psa_signal_t sig, psa_msg_t *msg);
   val_status_t (*process_call_request)       (psa_signal_t sig, psa_msg_t *msg);
   val_status_t (*process_disconnect_request) (psa_signal_t sig, psa_msg_t *msg);
+  val_status_t (*perf_measure)               (val_perf_fn_t fn, void *ctx,
+                                              val_perf_result_t *result);
+  void         (*perf_report)                (char *op, uint32_t alg, uint32_t size,
+                                              val_perf_result_t *result);
 } val_api_t;
 #endif
@@ -23,6 +23,7 @@ list(APPEND VAL_SRC_C_NSPE
 	${PSA_ROOT_DIR}/val/nspe/val_crypto.c
 	${PSA_ROOT_DIR}/val/nspe/val_interfaces.c
 	${PSA_ROOT_DIR}/val/nspe/val_peripherals.c
+	${PSA_ROOT_DIR}/val/nspe/val_log.c
 	${PSA_ROOT_DIR}/val/common/val_target.c
 	${PSA_ROOT_DIR}/val/nspe/val_protected_storage.c
 	${PSA_ROOT_DIR}/val/nspe/val_internal_trusted_storage.c
@@ -85,6 +85,12 @@ target_include_directories(${PSA_TARGET_SERVER_PARTITION_LIB} PRIVATE
 	${PSA_ROOT_DIR}/ff/partition/ipc
 )
 
+# Sources shared by the tests of the suite
+if(IS_DIRECTORY ${PSA_SUITE_DIR}/common)
+	target_include_directories(${PSA_TARGET_CLIENT_PARTITION_LIB} PRIVATE ${PSA_SUITE_DIR}/common)
+	target_include_directories(${PSA_TARGET_SERVER_PARTITION_LIB} PRIVATE ${PSA_SUITE_DIR}/common)
+endif()
+
 # PSA Include directories
 foreach(psa_inc_path ${PSA_INCLUDE_PATHS})
 	target_include_directories(${PSA_TARGET_DRIVER_PARTITION_LIB} PRIVATE ${psa_inc_path})